@@ -0,0 +1,355 @@
+/*
+    Frame mirror viewer
+
+    Decodes the frames sent by N5110::mirrorTo (MIRROR_LCD in main.cpp) from
+    a serial port, a pseudo-terminal (SIM_SERIAL=pty) or a file of captured
+    bytes (SIM_SERIAL=FILE). Packets are found by their 0xA5 0x5A header, so
+    the viewer can be started part way through a stream: delta frames are
+    ignored until the first key frame, and after a bad checksum until the
+    next one. The bytes of a bad packet are searched again for a header, as
+    a packet cut short by the sender runs into the one after it. At the end of the stream the packet sizes are compared with
+    what the serial port can carry at the frame rate (Ctrl-C ends a live
+    stream).
+
+    usage: viewer [--dump DIR] [--ascii] [--frame-ms N] [--baud N] [PORT|FILE|-]
+        --dump DIR    write each decoded frame to DIR/frame_NNNNN.pbm
+        --ascii       print each decoded frame to stdout
+        --frame-ms N  time per frame, for the bandwidth check (default 50)
+        --baud N      baud rate of the port (default 115200), a serial port
+                      is set to it
+        PORT|FILE|-   where to read from (default stdin)
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <signal.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define FRAME_COLS 84
+#define FRAME_BANKS 6
+#define FRAME_BYTES (FRAME_COLS * FRAME_BANKS)
+#define PACKET_OVERHEAD 7  // header, type, length and checksum
+
+struct Stats {
+    unsigned int key_frames;
+    unsigned int delta_frames;
+    unsigned int skipped;          // good packets before the first key frame
+    unsigned int checksum_errors;
+    unsigned int length_errors;    // payloads that did not decode to a frame
+    unsigned long long bytes;      // bytes in the decoded packets
+    unsigned int max_bytes;
+};
+
+unsigned char g_frame[FRAME_BYTES];  // display order, bank by bank
+bool g_have_frame = false;           // g_frame holds a checked frame
+Stats g_stats;
+const char *g_dump_dir = NULL;
+bool g_ascii = false;
+volatile sig_atomic_t g_stop = 0;  // set by Ctrl-C
+
+
+// interrupts the blocked read, so the stats are still printed
+void stop(int)
+{
+    g_stop = 1;
+}
+
+
+// Fletcher-16 as computed by N5110::sendMirror
+unsigned int fletcher16(const unsigned char *data, int length)
+{
+    unsigned int sum1 = 0;
+    unsigned int sum2 = 0;
+    for (int n = 0; n < length; n++) {
+        sum1 = (sum1 + data[n]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+    return sum1 | (sum2 << 8);
+}
+
+
+// decodes a run-length encoded payload (the drawSprite format), returns
+// false unless it is exactly one frame
+bool decodeRle(const unsigned char *in, int length, unsigned char *out)
+{
+    int i = 0;
+    int n = 0;
+    while (i < length) {
+        int const header = in[i++];
+        if (header < 128) {
+            int const count = header + 1;
+            if (i + count > length || n + count > FRAME_BYTES) {
+                return false;
+            }
+            memcpy(out + n, in + i, count);
+            i += count;
+            n += count;
+        } else {
+            int const count = header - 128 + 3;
+            if (i >= length || n + count > FRAME_BYTES) {
+                return false;
+            }
+            memset(out + n, in[i++], count);
+            n += count;
+        }
+    }
+    return n == FRAME_BYTES;
+}
+
+
+bool pixel(int x, int y)
+{
+    return (g_frame[(y / 8) * FRAME_COLS + x] >> (y % 8)) & 1;
+}
+
+bool writePbm(const char *path)
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        return false;
+    }
+    fprintf(fp, "P4\n%d %d\n", FRAME_COLS, FRAME_BANKS * 8);
+    for (int y = 0; y < FRAME_BANKS * 8; y++) {
+        unsigned char row[(FRAME_COLS + 7) / 8] = {0};
+        for (int x = 0; x < FRAME_COLS; x++) {
+            if (pixel(x, y)) {
+                row[x / 8] |= 0x80 >> (x % 8);
+            }
+        }
+        fwrite(row, 1, sizeof(row), fp);
+    }
+    fclose(fp);
+    return true;
+}
+
+// two pixel rows per line of text
+void printAscii(unsigned int number)
+{
+    printf("frame %u\n", number);
+    for (int y = 0; y < FRAME_BANKS * 8; y += 2) {
+        char line[FRAME_COLS + 1];
+        for (int x = 0; x < FRAME_COLS; x++) {
+            static const char chars[4] = {' ', '\'', '.', ':'};
+            line[x] = chars[pixel(x, y) | (pixel(x, y + 1) << 1)];
+        }
+        line[FRAME_COLS] = '\0';
+        printf("|%s|\n", line);
+    }
+    fflush(stdout);
+}
+
+
+// applies a packet with a complete payload to g_frame, returns false if it is bad
+bool handlePacket(unsigned char type, const unsigned char *payload, int length,
+                  unsigned int checksum)
+{
+    unsigned char decoded[FRAME_BYTES];
+    if (!decodeRle(payload, length, decoded)) {
+        g_stats.length_errors++;
+        g_have_frame = false;
+        return false;
+    }
+    if (type == 'D' && !g_have_frame) {
+        g_stats.skipped++;  // nothing to apply the delta to until a key frame
+        return true;
+    }
+    for (int n = 0; n < FRAME_BYTES; n++) {
+        g_frame[n] = type == 'K' ? decoded[n] : g_frame[n] ^ decoded[n];
+    }
+    if (fletcher16(g_frame, FRAME_BYTES) != checksum) {
+        g_stats.checksum_errors++;
+        g_have_frame = false;
+        return false;
+    }
+    g_have_frame = true;
+
+    if (type == 'K') {
+        g_stats.key_frames++;
+    } else {
+        g_stats.delta_frames++;
+    }
+    unsigned int const bytes = length + PACKET_OVERHEAD;
+    g_stats.bytes += bytes;
+    g_stats.max_bytes = bytes > g_stats.max_bytes ? bytes : g_stats.max_bytes;
+
+    unsigned int const number = g_stats.key_frames + g_stats.delta_frames;
+    if (g_dump_dir) {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/frame_%05u.pbm", g_dump_dir, number);
+        if (!writePbm(path)) {
+            fprintf(stderr, "could not write %s\n", path);
+        }
+    }
+    if (g_ascii) {
+        printAscii(number);
+    }
+    return true;
+}
+
+
+// the stream, with the bytes of bad packets put back to be read again
+class Input
+{
+public:
+    explicit Input(FILE *in) : _in(in), _pos(0) {}
+
+    int get()
+    {
+        if (_pos < _rescan.size()) {
+            return _rescan[_pos++];
+        }
+        return fgetc(_in);
+    }
+
+    // bytes are read again before what was still to be read again
+    void putBack(const std::vector<unsigned char> &bytes)
+    {
+        std::vector<unsigned char> rescan(bytes);
+        rescan.insert(rescan.end(), _rescan.begin() + _pos, _rescan.end());
+        _rescan.swap(rescan);
+        _pos = 0;
+    }
+
+private:
+    FILE *_in;
+    std::vector<unsigned char> _rescan;
+    size_t _pos;
+};
+
+
+// reads packets until the end of the stream
+void readStream(FILE *file)
+{
+    Input in(file);
+    std::vector<unsigned char> packet;  // the bytes after 0xA5
+    int c = in.get();
+    while (c != EOF && !g_stop) {
+        // find the packet header
+        if (c != 0xA5) {
+            c = in.get();
+            continue;
+        }
+        c = in.get();
+        if (c != 0x5A) {
+            continue;  // c may be the start of the next header
+        }
+        packet.assign(1, 0x5A);
+        for (int n = 0; n < 3; n++) {
+            c = in.get();
+            if (c == EOF) {
+                return;
+            }
+            packet.push_back(c);
+        }
+        int const type = packet[1];
+        if (type != 'K' && type != 'D') {
+            c = in.get();
+            continue;
+        }
+        int const length = packet[2] | (packet[3] << 8);
+        for (int n = 0; n < length + 2; n++) {  // payload and checksum
+            c = in.get();
+            if (c == EOF) {
+                return;
+            }
+            packet.push_back(c);
+        }
+        unsigned int const checksum = packet[4 + length] | (packet[5 + length] << 8);
+        if (!handlePacket(type, &packet[4], length, checksum)) {
+            in.putBack(std::vector<unsigned char>(packet.begin() + 1, packet.end()));
+        }
+        c = in.get();
+    }
+}
+
+
+speed_t baudConstant(int baud)
+{
+    switch (baud) {
+        case 9600:   return B9600;
+        case 19200:  return B19200;
+        case 38400:  return B38400;
+        case 57600:  return B57600;
+        case 230400: return B230400;
+        case 460800: return B460800;
+        case 921600: return B921600;
+        default:     return B115200;
+    }
+}
+
+
+int main(int argc, char *argv[])
+{
+    int frame_ms = 50;
+    int baud = 115200;
+    const char *source = "-";
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--dump" && i + 1 < argc) {
+            g_dump_dir = argv[++i];
+        } else if (arg == "--ascii") {
+            g_ascii = true;
+        } else if (arg == "--frame-ms" && i + 1 < argc) {
+            frame_ms = atoi(argv[++i]);
+        } else if (arg == "--baud" && i + 1 < argc) {
+            baud = atoi(argv[++i]);
+        } else if (arg[0] != '-' || arg == "-") {
+            source = argv[i];
+        } else {
+            fprintf(stderr, "usage: %s [--dump DIR] [--ascii] [--frame-ms N] [--baud N] "
+                    "[PORT|FILE|-]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (frame_ms < 1 || baud < 1) {
+        fprintf(stderr, "--frame-ms and --baud must be at least 1\n");
+        return 1;
+    }
+
+    FILE *in = stdin;
+    if (strcmp(source, "-") != 0) {
+        in = fopen(source, "rb");
+        if (!in) {
+            fprintf(stderr, "could not open %s\n", source);
+            return 1;
+        }
+    }
+    if (isatty(fileno(in))) {
+        // raw mode, so the bytes are not translated or line buffered
+        termios tio;
+        tcgetattr(fileno(in), &tio);
+        cfmakeraw(&tio);
+        cfsetispeed(&tio, baudConstant(baud));
+        cfsetospeed(&tio, baudConstant(baud));
+        tcsetattr(fileno(in), TCSANOW, &tio);
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = stop;  // without SA_RESTART, so fgetc returns EOF
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    readStream(in);
+
+    unsigned int const frames = g_stats.key_frames + g_stats.delta_frames;
+    // 10 bits per byte on the wire (start, 8 data, stop)
+    double const budget = baud / 10.0 * frame_ms / 1000.0;
+    double const mean = frames ? (double)g_stats.bytes / frames : 0;
+    fprintf(stderr, "frames %u (%u key, %u delta), %u skipped before a key frame\n",
+            frames, g_stats.key_frames, g_stats.delta_frames, g_stats.skipped);
+    fprintf(stderr, "errors: %u checksum, %u length\n",
+            g_stats.checksum_errors, g_stats.length_errors);
+    fprintf(stderr, "bytes per frame: mean %.1f, max %u (raw frame %d)\n",
+            mean, g_stats.max_bytes, FRAME_BYTES + PACKET_OVERHEAD);
+    fprintf(stderr, "%d baud at %d ms per frame carries %.0f bytes per frame: "
+            "mean %s, max %s\n", baud, frame_ms, budget,
+            mean <= budget ? "fits" : "does not fit",
+            g_stats.max_bytes <= budget ? "fits" : "does not fit");
+    return g_stats.checksum_errors + g_stats.length_errors ? 2 : 0;
+}
@@ -0,0 +1,588 @@
+/*
+    Level generator
+
+    Writes lib2/Levels.cpp: the hand designed levels 0-7 as they are in the
+    table linked into this tool, and levels 8-23 generated from tile
+    multisets. Every multiset of tile kinds that fills the 27 cells of the
+    game space with a number of tiles in the --tiles range is listed, a
+    seeded sample of them is taken and each is shuffled into --orders
+    placing orders. Each candidate is searched exhaustively, with the moves
+    the game allows (findPlacements), by worker threads. The search counts
+    the solutions (the sequences of moves that fill the space), the mean
+    number of moves at the positions that can still be won (branching) and
+    the chance that a game of uniformly random moves is won. The difficulty
+    of a level is -log2 of that chance, so each point halves it.
+
+    A candidate is kept if it has between --min-solutions and --max-solutions
+    solutions and the game's Solver proves it solvable from the start within
+    GAME_SOLVER_BUDGET positions, so that the game can give hints from the
+    first move. Sixteen levels with different multisets are picked from the
+    kept candidates, spread evenly over their range of difficulty and in
+    increasing order. The same seed and options give the same table,
+    whatever the number of threads.
+
+    Candidates that reach more than --max-states positions are skipped, the
+    designed levels are always searched to the end.
+
+    usage: levelgen [--seed N] [--threads N] [--candidates N] [--orders N]
+                    [--max-states N] [--tiles MIN-MAX] [--min-solutions N]
+                    [--max-solutions N] > ../lib2/Levels.cpp
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <pthread.h>
+#include <unistd.h>
+#include "Utils.h"
+#include "Game.h"
+
+#define FULL_SPACE 0x7FFFFFF
+#define DESIGNED_LEVELS 8
+#define EMPTY_KEY 0xFFFFFFFF       // a full space is never stored either
+#define TABLE_BITS 16              // initial size of the position table, it doubles when half full
+#define DESIGNED_MAX_STATES (1 << 24) // the designed levels are always searched to the end
+#define SOLUTION_LIMIT 1000000000ULL // counts saturate here
+
+const char *kind_names[TILE_KINDS] = {
+    "TILE_O", "TILE_i", "TILE_l", "TILE_I", "TILE_L",
+    "TILE_T", "TILE_C", "TILE_Z", "TILE_X"
+};
+
+struct Options{
+    unsigned int seed;
+    int threads;
+    int candidates;     // multisets sampled
+    int orders;         // placing orders tried for each multiset
+    int max_states;     // a candidate with more positions is skipped
+    int min_tiles;
+    int max_tiles;
+    unsigned long long min_solutions;
+    unsigned long long max_solutions;
+};
+
+struct Candidate{
+    int multiset;       // index in the list of multisets, -1 for a designed level
+    std::vector<TileKind> tiles;
+};
+
+struct Metrics{
+    bool complete;      // searched within the position limit
+    unsigned long long solutions;
+    double branching;
+    double win_chance;
+    unsigned int states;
+    SolveResult solver_result;
+    int solver_nodes;
+};
+
+// the result of searching one position
+struct Value{
+    unsigned long long solutions;
+    double win_chance;
+};
+
+
+// xorshift32, so the tables do not depend on the C library's rand
+class Random
+{
+public:
+    explicit Random(unsigned int seed) : _state(seed ? seed:1) {}
+    unsigned int next()
+    {
+        _state ^= _state << 13;
+        _state ^= _state >> 17;
+        _state ^= _state << 5;
+        return _state;
+    }
+    // a value from 0 to n-1
+    int below(int n)
+    {
+        return next() % n;
+    }
+private:
+    unsigned int _state;
+};
+
+template <class T>
+void shuffle(std::vector<T> &list, Random &random)
+{
+    for(int n = (int)list.size()-1; n > 0; n--){
+        std::swap(list[n], list[random.below(n+1)]);
+    }
+}
+
+
+int cells(int kind)
+{
+    return __builtin_popcount(tile_orientations[kind].tile.shape);
+}
+
+double difficulty(const Metrics &metrics)
+{
+    return metrics.win_chance > 0 ? -log2(metrics.win_chance):INFINITY;
+}
+
+
+// every placement mask of a tile kind, for the coverability check
+std::vector<int> kind_masks[TILE_KINDS];
+
+void findKindMasks()
+{
+    for(int kind = 0; kind < TILE_KINDS; kind++){
+        const TileOrientations &orientations = tile_orientations[kind];
+        for(int i = 0; i < orientations.count; i++){
+            const Orientation &orientation = orientations.orientations[i];
+            int const count = (4-orientation.tile.size[0])*(4-orientation.tile.size[1])*(4-orientation.tile.size[2]);
+            kind_masks[kind].insert(kind_masks[kind].end(), orientation.placements,
+                                    orientation.placements + count);
+        }
+    }
+}
+
+
+// lists the multisets of tile kinds (as counts of each kind) that cover
+// exactly the free cells with between min and max tiles
+void findMultisets(int kind, int free_cells, int tiles, const Options &options,
+                   std::vector<int> &counts, std::vector<std::vector<int> > &multisets)
+{
+    if(free_cells == 0){
+        if(tiles >= options.min_tiles){
+            multisets.push_back(counts);
+        }
+        return;
+    }
+    if(kind == TILE_KINDS){
+        return;
+    }
+    for(int n = 0; n*cells(kind) <= free_cells && tiles+n <= options.max_tiles; n++){
+        counts[kind] = n;
+        findMultisets(kind+1, free_cells - n*cells(kind), tiles+n, options, counts, multisets);
+    }
+    counts[kind] = 0;
+}
+
+
+// exhaustive search of one tile list, remembering every position it reaches
+class Evaluator
+{
+public:
+    Metrics evaluate(const std::vector<TileKind> &tiles, unsigned int max_states)
+    {
+        _tiles = tiles;
+        _kinds_left.assign(tiles.size(), 0);
+        unsigned short kinds = 0;
+        for(int n = (int)tiles.size()-1; n >= 0; n--){
+            kinds |= 1 << tiles[n];
+            _kinds_left[n] = kinds;
+        }
+        _keys.assign(1 << TABLE_BITS, EMPTY_KEY);
+        _values.resize(1 << TABLE_BITS);
+        _mask = (1 << TABLE_BITS) - 1;
+        _states = 0;
+        _max_states = max_states;
+        _overflow = false;
+        _live_states = 0;
+        _live_moves = 0;
+
+        Value const value = search(0, 0);
+
+        Metrics metrics;
+        metrics.complete = !_overflow;
+        metrics.solutions = value.solutions;
+        metrics.win_chance = value.win_chance;
+        metrics.branching = _live_states ? (double)_live_moves / _live_states:0;
+        metrics.states = _states;
+
+        // the check the game makes when the level is started
+        Level level(&_tiles[0], _tiles.size());
+        _solver.reset();
+        metrics.solver_result = _solver.solve(0, level, 0, GAME_SOLVER_BUDGET);
+        metrics.solver_nodes = _solver.getNodes();
+        return metrics;
+    }
+
+private:
+    Value search(unsigned int space, int index)
+    {
+        Value value = {0, 0};
+        if(space == FULL_SPACE){
+            value.solutions = 1;
+            value.win_chance = 1;
+            return value;
+        }
+        unsigned int const key = space | (index << 27);
+        unsigned int const slot = find(key);
+        if(_keys[slot] == key){
+            return _values[slot];
+        }
+        if(_overflow || _states >= _max_states){
+            _overflow = true;
+            return value;
+        }
+
+        if(coverable(space, index)){
+            const TileOrientations &orientations = tile_orientations[_tiles[index]];
+            int const next = index+1 < (int)_tiles.size() ? index+1:index; // the last tile repeats
+            int moves = 0;
+            for(int i = 0; i < orientations.count; i++){
+                PlacementList pos_list = findPlacements(orientations.orientations[i], space);
+                for(int n = 0; n < pos_list.count; n++){
+                    Value const child = search(space | pos_list.masks[n], next);
+                    value.solutions = std::min(value.solutions + child.solutions, SOLUTION_LIMIT);
+                    value.win_chance += child.win_chance;
+                    moves++;
+                }
+            }
+            if(moves > 0){
+                value.win_chance /= moves;
+            }
+            if(value.solutions > 0){
+                _live_states++;
+                _live_moves += moves;
+            }
+        }
+
+        insert(key, value); // the table may have changed in the search
+        return value;
+    }
+
+    // the slot holding key, or the empty slot it would go in (linear probing
+    // from its Fibonacci hash)
+    unsigned int find(unsigned int key)
+    {
+        unsigned int slot = (key * 2654435761u) >> __builtin_clz(_mask);
+        while(_keys[slot] != EMPTY_KEY && _keys[slot] != key){
+            slot = (slot + 1) & _mask;
+        }
+        return slot;
+    }
+
+    void insert(unsigned int key, const Value &value)
+    {
+        if(2*(_states+1) > _mask+1){
+            std::vector<unsigned int> keys(2*(_mask+1), EMPTY_KEY);
+            std::vector<Value> values(keys.size());
+            keys.swap(_keys);
+            values.swap(_values);
+            _mask = 2*_mask + 1;
+            for(size_t n = 0; n < keys.size(); n++){
+                if(keys[n] != EMPTY_KEY){
+                    unsigned int const slot = find(keys[n]);
+                    _keys[slot] = keys[n];
+                    _values[slot] = values[n];
+                }
+            }
+        }
+        unsigned int const slot = find(key);
+        _keys[slot] = key;
+        _values[slot] = value;
+        _states++;
+    }
+
+    // as Solver::coverable, false if an empty cell can't be covered by any of the tiles left
+    bool coverable(unsigned int space, int index)
+    {
+        unsigned int covered = space;
+        for(int kind = 0; kind < TILE_KINDS; kind++){
+            if(!(_kinds_left[index] & (1 << kind))){
+                continue;
+            }
+            const std::vector<int> &masks = kind_masks[kind];
+            for(size_t n = 0; n < masks.size(); n++){
+                if((masks[n] & space) == 0){
+                    covered |= masks[n];
+                }
+            }
+        }
+        return covered == FULL_SPACE;
+    }
+
+    std::vector<TileKind> _tiles;
+    std::vector<unsigned short> _kinds_left;
+    std::vector<unsigned int> _keys;
+    std::vector<Value> _values;
+    unsigned int _mask;
+    unsigned int _states;
+    unsigned int _max_states;
+    bool _overflow;
+    unsigned long long _live_states;
+    unsigned long long _live_moves;
+    Solver _solver;
+};
+
+
+// the work shared by the threads, each result is written to its own slot
+struct Work{
+    const std::vector<Candidate> *candidates;
+    std::vector<Metrics> *results;
+    unsigned int max_states;
+    size_t next;
+    pthread_mutex_t lock;
+};
+
+void *worker(void *arg)
+{
+    Work *work = (Work *)arg;
+    Evaluator evaluator;
+    for(;;){
+        pthread_mutex_lock(&work->lock);
+        size_t const n = work->next++;
+        pthread_mutex_unlock(&work->lock);
+        if(n >= work->candidates->size()){
+            break;
+        }
+        const Candidate &candidate = (*work->candidates)[n];
+        (*work->results)[n] = evaluator.evaluate(candidate.tiles, candidate.multiset < 0 ?
+                                                 DESIGNED_MAX_STATES:work->max_states);
+        if(n % 100 == 99){
+            fprintf(stderr, "\r%u of %u candidates", (unsigned int)n+1,
+                    (unsigned int)work->candidates->size());
+        }
+    }
+    return NULL;
+}
+
+void evaluateAll(const std::vector<Candidate> &candidates, std::vector<Metrics> &results,
+                 int threads, int max_states)
+{
+    results.resize(candidates.size());
+    Work work;
+    work.candidates = &candidates;
+    work.results = &results;
+    work.max_states = max_states;
+    work.next = 0;
+    pthread_mutex_init(&work.lock, NULL);
+    std::vector<pthread_t> ids(threads);
+    for(int n = 0; n < threads; n++){
+        pthread_create(&ids[n], NULL, worker, &work);
+    }
+    for(int n = 0; n < threads; n++){
+        pthread_join(ids[n], NULL);
+    }
+    pthread_mutex_destroy(&work.lock);
+    fprintf(stderr, "\r%u candidates searched\n", (unsigned int)candidates.size());
+}
+
+
+// orders candidates by difficulty, then by their place in the list
+struct ByDifficulty{
+    const std::vector<Metrics> *results;
+    bool operator()(int a, int b) const
+    {
+        double const da = difficulty((*results)[a]);
+        double const db = difficulty((*results)[b]);
+        return da != db ? da < db:a < b;
+    }
+};
+
+// picks count candidates with different multisets, spread evenly over the
+// kept ones in order of difficulty
+std::vector<int> pickLevels(const std::vector<Candidate> &candidates,
+                            const std::vector<int> &kept, int count)
+{
+    std::vector<int> picked;
+    std::vector<bool> used;
+    for(int i = 0; i < count && !kept.empty(); i++){
+        int const target = (int)((2*i + 1) * kept.size() / (2*count));
+        // the nearest unused multiset, looking at harder levels first
+        for(int d = 0; d < (int)kept.size(); d++){
+            int const tries[2] = {target + d, target - d};
+            int found = -1;
+            for(int t = 0; t < 2 && found < 0; t++){
+                if(tries[t] < 0 || tries[t] >= (int)kept.size()){
+                    continue;
+                }
+                int const multiset = candidates[kept[tries[t]]].multiset;
+                if(multiset >= (int)used.size()){
+                    used.resize(multiset+1, false);
+                }
+                if(!used[multiset]){
+                    found = kept[tries[t]];
+                }
+            }
+            if(found >= 0){
+                used[candidates[found].multiset] = true;
+                picked.push_back(found);
+                break;
+            }
+        }
+    }
+    return picked;
+}
+
+
+void printLevel(int number, const std::vector<TileKind> &tiles, const Metrics &metrics)
+{
+    printf("// %u tiles, ", (unsigned int)tiles.size());
+    if(!metrics.complete){
+        printf("too many positions to search\n");
+    }else{
+        printf("%llu solution%s, branching %.1f, difficulty %.1f", metrics.solutions,
+               metrics.solutions == 1 ? "":"s", metrics.branching, difficulty(metrics));
+        if(metrics.win_chance > 0){
+            printf(" (1 in %.0f random games won)", 1 / metrics.win_chance);
+        }
+        printf("\n");
+    }
+    printf("const TileKind level%d[%u] = {", number, (unsigned int)tiles.size());
+    for(size_t n = 0; n < tiles.size(); n++){
+        printf("%s%s", n ? ", ":"", kind_names[tiles[n]]);
+    }
+    printf("};\n");
+}
+
+
+bool parseArgs(int argc, char *argv[], Options &options)
+{
+    for(int i = 1; i < argc; i++){
+        std::string arg = argv[i];
+        if(i + 1 >= argc){
+            return false;
+        }
+        const char *value = argv[++i];
+        if(arg == "--seed"){
+            options.seed = strtoul(value, NULL, 0);
+        }else if(arg == "--threads"){
+            options.threads = atoi(value);
+        }else if(arg == "--candidates"){
+            options.candidates = atoi(value);
+        }else if(arg == "--orders"){
+            options.orders = atoi(value);
+        }else if(arg == "--max-states"){
+            options.max_states = atoi(value);
+        }else if(arg == "--tiles"){
+            if(sscanf(value, "%d-%d", &options.min_tiles, &options.max_tiles) != 2){
+                return false;
+            }
+        }else if(arg == "--min-solutions"){
+            options.min_solutions = strtoull(value, NULL, 0);
+        }else if(arg == "--max-solutions"){
+            options.max_solutions = strtoull(value, NULL, 0);
+        }else{
+            return false;
+        }
+    }
+    return options.threads >= 1 && options.candidates >= 1 && options.orders >= 1 &&
+           options.max_states >= 1 &&
+           options.min_tiles >= 1 && options.min_tiles <= options.max_tiles &&
+           options.max_tiles <= SOLVER_MAX_TILES && options.min_solutions >= 1 &&
+           options.min_solutions <= options.max_solutions;
+}
+
+
+int main(int argc, char *argv[])
+{
+    Options options;
+    options.seed = 1;
+    options.threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    options.threads = options.threads > 0 ? options.threads:1;
+    options.candidates = 400;
+    options.orders = 3;
+    options.max_states = 1 << 17;
+    options.min_tiles = 6;
+    options.max_tiles = 8;
+    options.min_solutions = 1;
+    options.max_solutions = 20000;
+    if(!parseArgs(argc, argv, options)){
+        fprintf(stderr, "usage: %s [--seed N] [--threads N] [--candidates N] [--orders N]\n"
+                "       [--max-states N] [--tiles MIN-MAX] [--min-solutions N]\n"
+                "       [--max-solutions N]\n", argv[0]);
+        return 1;
+    }
+    findKindMasks();
+
+    // the candidates: a seeded sample of the multisets, each in a few orders
+    std::vector<int> counts(TILE_KINDS, 0);
+    std::vector<std::vector<int> > multisets;
+    findMultisets(0, 27, 0, options, counts, multisets);
+    Random random(options.seed);
+    shuffle(multisets, random);
+    if((int)multisets.size() > options.candidates){
+        multisets.resize(options.candidates);
+    }
+    std::vector<Candidate> candidates;
+    for(size_t m = 0; m < multisets.size(); m++){
+        Candidate candidate;
+        candidate.multiset = m;
+        for(int kind = 0; kind < TILE_KINDS; kind++){
+            candidate.tiles.insert(candidate.tiles.end(), multisets[m][kind], (TileKind)kind);
+        }
+        for(int n = 0; n < options.orders; n++){
+            shuffle(candidate.tiles, random);
+            candidates.push_back(candidate);
+        }
+    }
+    fprintf(stderr, "%u multisets, %u candidates, %d threads\n", (unsigned int)multisets.size(),
+            (unsigned int)candidates.size(), options.threads);
+
+    // the designed levels are searched too, for their comments
+    for(int n = 0; n < DESIGNED_LEVELS; n++){
+        Candidate candidate;
+        candidate.multiset = -1;
+        candidate.tiles.assign(levels[n].data(), levels[n].data() + levels[n].size());
+        candidates.push_back(candidate);
+    }
+    std::vector<Metrics> results;
+    evaluateAll(candidates, results, options.threads, options.max_states);
+
+    std::vector<int> kept;
+    int incomplete = 0;
+    int unsolved = 0;
+    for(size_t n = 0; n + DESIGNED_LEVELS < candidates.size(); n++){
+        const Metrics &metrics = results[n];
+        incomplete += !metrics.complete;
+        unsolved += metrics.complete && metrics.solutions > 0 &&
+                    metrics.solver_result != SOLVE_SOLVABLE;
+        if(metrics.complete && metrics.solutions >= options.min_solutions &&
+           metrics.solutions <= options.max_solutions &&
+           metrics.solver_result == SOLVE_SOLVABLE){
+            kept.push_back(n);
+        }
+    }
+    ByDifficulty by_difficulty = {&results};
+    std::sort(kept.begin(), kept.end(), by_difficulty);
+    int const generated = LEVEL_COUNT - DESIGNED_LEVELS;
+    std::vector<int> picked = pickLevels(candidates, kept, generated);
+    fprintf(stderr, "%u kept (%d too big to search, %d solvable but not within the solver "
+            "budget), %u levels picked\n", (unsigned int)kept.size(), incomplete, unsolved,
+            (unsigned int)picked.size());
+    if((int)picked.size() < generated){
+        fprintf(stderr, "not enough levels, try more --candidates or a wider solution range\n");
+    }
+
+    printf("/*\n"
+           "    Level catalogue\n"
+           "    The tiles of each level in the order they are placed, kept in flash so\n"
+           "    that a level can be selected without building a list of its tiles\n\n"
+           "    Generated by host/LevelGen.cpp (levelgen --seed %u --candidates %d --orders %d\n"
+           "    --max-states %d --tiles %d-%d --min-solutions %llu --max-solutions %llu).\n"
+           "    Levels 0-%d are designed by hand: edit them here and run make levels to\n"
+           "    check them.\n"
+           "    Difficulty is -log2 of the chance that random moves win the level\n"
+           "*/\n\n"
+           "#include \"Utils.h\"\n\n",
+           options.seed, options.candidates, options.orders, options.max_states, options.min_tiles,
+           options.max_tiles, options.min_solutions, options.max_solutions, DESIGNED_LEVELS-1);
+    for(int n = 0; n < DESIGNED_LEVELS; n++){
+        size_t const index = candidates.size() - DESIGNED_LEVELS + n;
+        printLevel(n, candidates[index].tiles, results[index]);
+    }
+    for(size_t n = 0; n < picked.size(); n++){
+        printLevel(DESIGNED_LEVELS + n, candidates[picked[n]].tiles, results[picked[n]]);
+    }
+    printf("\nconst Level levels[LEVEL_COUNT] = {\n");
+    for(int n = 0; n < LEVEL_COUNT; n++){
+        if(n < DESIGNED_LEVELS + (int)picked.size()){
+            printf("    Level(level%d),\n", n);
+        }else{
+            printf("    Level(),\n");
+        }
+    }
+    printf("};\n");
+    return (int)picked.size() < generated ? 2:0;
+}
@@ -0,0 +1,234 @@
+/*
+    Tile orientation table generator
+
+    Writes lib2/Orientations.cpp: for every tile kind, the distinct
+    orientations it can be placed in, so that Game::validRotations looks
+    them up instead of rotating the tile and its bounding box 24 times
+    whenever a piece is placed or rotated. The 24 rotations are the ones
+    Game::validRotations used, in the same order, and each orientation is
+    moved to the 0,0,0 corner of the space. Rotations that give the same
+    shape (because of the symmetry of the tile) are only listed once, in the
+    order they are first reached.
+
+    Each orientation also gets the game space mask of every position it can
+    be translated to, in the order Game::validTranslations tries them: for
+    each y, z offset (y first), the x offsets from 3-size[0] down to 0.
+
+    usage: orientgen > ../lib2/Orientations.cpp
+*/
+
+#include <stdio.h>
+#include <vector>
+
+struct Tile{
+    int shape;
+    char size[3];
+};
+
+struct Kind{
+    const char *name;
+    Tile tile;
+};
+
+// the tile kinds, in TileKind order (see Utils.h)
+const Kind kinds[] = {
+    {"TILE_O", {0x4000000, {1,1,1}}},
+    {"TILE_i", {0x6000000, {2,1,1}}},
+    {"TILE_l", {0x6800000, {2,2,1}}},
+    {"TILE_I", {0x7000000, {3,1,1}}},
+    {"TILE_L", {0x7200000, {3,2,1}}},
+    {"TILE_T", {0x7400000, {3,2,1}}},
+    {"TILE_C", {0x7A00000, {3,2,1}}},
+    {"TILE_Z", {0x6600000, {3,2,1}}},
+    {"TILE_X", {0x6820000, {2,2,2}}},
+};
+
+const int all_rot[24][3] =  {{0,0,0},{0,0,1},{0,0,2},{0,0,3},
+                             {1,0,0},{1,0,1},{1,0,2},{1,0,3},
+                             {2,0,0},{2,0,1},{2,0,2},{2,0,3},
+                             {3,0,0},{3,0,1},{3,0,2},{3,0,3},
+                             {0,1,0},{0,1,1},{0,1,2},{0,1,3},
+                             {0,3,0},{0,3,1},{0,3,2},{0,3,3}};
+
+
+// translates a 3x3x3 game space by i, j, k (was Game::translateSpace)
+int translateSpace(int input_space, int i, int j, int k)
+{
+    int output_space = input_space;
+    for(int n = 0; n < i; n++){
+        // translate by 1 bit in x direction
+        output_space = (output_space & 0x6DB6DB6) >> 1;
+    }
+    for(int n = 0; n < j; n++){
+        // translate by 1 bit in y direction
+        output_space = (output_space & 0x7E3F1F8) >> 3;
+    }
+    for(int n = 0; n < k; n++){
+        // translate by 1 bit in z direction
+        output_space = output_space >> 9;
+    }
+    return output_space;
+}
+
+
+// the game space masks of every translation of an orientation
+std::vector<int> placements(Tile tile)
+{
+    std::vector<int> masks;
+    int const operand = 4 - tile.size[1];
+    for(int i = 0; i < (4-tile.size[1])*(4-tile.size[2]); i++){
+        for(int x = 3 - tile.size[0]; x >= 0; x--){
+            masks.push_back(translateSpace(tile.shape, x, i%operand, i/operand));
+        }
+    }
+    return masks;
+}
+
+
+// rotates a tile by i, j and k quarter turns about the x, y and z axes (the
+// bit permutations that were Game::rotateSpace)
+Tile rotateSpace(Tile input_tile, int i, int j, int k)
+{
+    Tile output = input_tile;
+    int temp = 0; // variable to store intermediate rotations
+
+    // rotation in  about the x axis
+    for(int n = 0; n < i; n++){
+        int temp0 = output.size[0];
+        output.size[0] = output.size[1];
+        output.size[1] = temp0;
+
+        for(int b = 0; b < 27; b++){
+            // the formula below rearranges bit at index b to index b'
+            // corrisponding to a rotation
+            temp |= ((output.shape & (0x4000000 >> b)) << b)
+                    >> ((2-((b%9)/3)) + ((b%3)*3) + (9*(b/9)));
+        }
+        output.shape = temp;
+        temp = 0;
+    }
+
+    // rotation in  about the y axis
+    for(int n = 0; n < j; n++){
+        int temp1 = output.size[1];
+        output.size[1] = output.size[2];
+        output.size[2] = temp1;
+
+        for(int b = 0; b < 27; b++){
+            // bit-wise rotation formula for y axis
+            temp |= ((output.shape & (0x4000000 >> b)) << b)
+                    >> (b + (6*((-2*(b/9)) + ((b%9)/3)+1)));
+        }
+        output.shape = temp;
+        temp = 0;
+    }
+
+    // rotation in  about the z axis
+    for(int n = 0; n < k; n++){
+        int temp2 = output.size[2];
+        output.size[2] = output.size[0];
+        output.size[0] = temp2;
+
+        for(int b = 0; b < 27; b++){
+            // bit-wise rotation formula for z axis
+            temp |= ((output.shape & (0x4000000 >> b)) << b)
+                    >> (b + ((9*(2-(b/9) - (b%3))) + (b/9) - (b%3)));
+        }
+        output.shape = temp;
+        temp = 0;
+    }
+    return output;
+}
+
+
+// the distinct orientations of a tile, as Game::validRotations found them
+std::vector<Tile> orientations(Tile input_tile)
+{
+    std::vector<Tile> rot_list;
+    for(int i = 0; i < 24; i++){
+        // the bounding box of the tile, rotated with it to find the corner
+        Tile convex_hull = {0x4000000, {0,0,0}};
+        for(int b = 0; b < input_tile.size[0]-1; b++){
+            convex_hull.shape |= convex_hull.shape >> 1;
+        }
+        for(int b = 0; b < input_tile.size[1]-1; b++){
+            convex_hull.shape |= convex_hull.shape >> 3;
+        }
+        for(int b = 0; b < input_tile.size[2]-1; b++){
+            convex_hull.shape |= convex_hull.shape >> 9;
+        }
+
+        Tile tile = rotateSpace(input_tile, all_rot[i][0], all_rot[i][1], all_rot[i][2]);
+        convex_hull = rotateSpace(convex_hull, all_rot[i][0], all_rot[i][1], all_rot[i][2]);
+        tile.shape = tile.shape << (__builtin_clz(convex_hull.shape)-5); // Move to 0,0,0 corner
+
+        bool duplicate = false;
+        for(size_t n = 0; n < rot_list.size(); n++){
+            duplicate |= rot_list[n].shape == tile.shape;
+        }
+        if(!duplicate){
+            rot_list.push_back(tile);
+        }
+    }
+    return rot_list;
+}
+
+
+int main()
+{
+    int const kind_count = sizeof(kinds) / sizeof(kinds[0]);
+    std::vector<Tile> lists[kind_count];
+    int total = 0;
+    int total_placements = 0;
+    for(int n = 0; n < kind_count; n++){
+        lists[n] = orientations(kinds[n].tile);
+        total += lists[n].size();
+        for(size_t r = 0; r < lists[n].size(); r++){
+            total_placements += placements(lists[n][r]).size();
+        }
+    }
+
+    printf("/*\n"
+           "    Tile orientation tables\n"
+           "    Generated by host/OrientationGen.cpp (orientgen), do not edit\n"
+           "*/\n\n"
+           "#include \"Utils.h\"\n\n");
+
+    printf("// the game space masks of every translation of each orientation\n");
+    printf("const int tile_placement_list[%d] = {", total_placements);
+    for(int n = 0; n < kind_count; n++){
+        for(size_t r = 0; r < lists[n].size(); r++){
+            std::vector<int> masks = placements(lists[n][r]);
+            for(size_t m = 0; m < masks.size(); m++){
+                printf("%s0x%07X,", m % 6 == 0 ? "\n    " : " ", masks[m]);
+            }
+        }
+    }
+    printf("\n};\n\n");
+
+    printf("// the distinct orientations of every tile kind, moved to the 0,0,0 corner\n");
+    printf("const Orientation tile_orientation_list[%d] = {\n", total);
+    int offset = 0;
+    for(int n = 0; n < kind_count; n++){
+        printf("    // %s\n", kinds[n].name);
+        for(size_t r = 0; r < lists[n].size(); r++){
+            const Tile &tile = lists[n][r];
+            printf("    {{0x%07X, {%d,%d,%d}}, tile_placement_list + %3d},\n", tile.shape,
+                   tile.size[0], tile.size[1], tile.size[2], offset);
+            offset += placements(tile).size();
+        }
+    }
+    printf("};\n\n");
+
+    printf("const TileOrientations tile_orientations[TILE_KINDS] = {\n");
+    offset = 0;
+    for(int n = 0; n < kind_count; n++){
+        const Tile &tile = kinds[n].tile;
+        printf("    {{0x%07X, {%d,%d,%d}}, %2u, tile_orientation_list + %2d},  // %s\n",
+               tile.shape, tile.size[0], tile.size[1], tile.size[2],
+               (unsigned int)lists[n].size(), offset, kinds[n].name);
+        offset += lists[n].size();
+    }
+    printf("};\n");
+    return 0;
+}
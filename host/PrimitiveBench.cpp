@@ -0,0 +1,376 @@
+/*
+    2D primitive benchmark
+
+    Times the N5110 line, circle, rectangle, blit and Bitmap drawing against the reference
+    versions below (the per-pixel implementations they replaced) on the
+    simulated framebuffer. Each case draws the same shapes with both, and
+    the number of pixels where the two results differ is reported next to
+    the times, so a change in the output is visible as well as the speedup.
+
+    usage: primbench [--repeat N]
+        --repeat N  times each case is drawn per batch (default 200), the mean
+                    time of the fastest of 5 batches is reported
+*/
+
+#include <string>
+#include <time.h>
+
+#include "mbed.h"
+#include "Sim.h"
+#include "N5110.h"
+#include "Bitmap.h"
+
+struct Case{
+    const char *name;
+    void (*draw)(bool reference);  // draws the case with the reference or the library code
+    bool start_black;              // fill the buffer before drawing (for white shapes)
+};
+
+int g_repeat = 200;
+
+
+double nowUs()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+
+// reference drawLine: linear interpolation with a divide per pixel
+void referenceLine(unsigned int const x0,
+                   unsigned int const y0,
+                   unsigned int const x1,
+                   unsigned int const y1,
+                   unsigned int const type)
+{
+    int const y_range = static_cast<int>(y1) - static_cast<int>(y0);
+    int const x_range = static_cast<int>(x1) - static_cast<int>(x0);
+    unsigned int const step = (type==2) ? 2:1;
+
+    if ( abs(x_range) > abs(y_range) ) {
+        unsigned int const start = x_range > 0 ? x0:x1;
+        unsigned int const stop =  x_range > 0 ? x1:x0;
+        for (unsigned int x = start; x<= stop ; x+=step) {
+            int const dx = static_cast<int>(x)-static_cast<int>(x0);
+            unsigned int const y = y0 + y_range * dx / x_range;
+            lcd.setPixel(x,y, type);
+        }
+    } else {
+        unsigned int const start = y_range > 0 ? y0:y1;
+        unsigned int const stop =  y_range > 0 ? y1:y0;
+        for (unsigned int y = start; y<= stop ; y+=step) {
+            int const dy = static_cast<int>(y)-static_cast<int>(y0);
+            unsigned int const x = y_range != 0 ? x0 + x_range * dy / y_range : x0;
+            lcd.setPixel(x,y, type);
+        }
+    }
+}
+
+
+// reference filled drawCircle: four reference lines per midpoint step
+void referenceCircle(unsigned int const x0,
+                     unsigned int const y0,
+                     unsigned int const radius,
+                     FillType const     fill)
+{
+    int x = radius;
+    int y = 0;
+    int radiusError = 1-x;
+    int type = (fill==FILL_BLACK) ? 1:0;
+
+    while(x >= y) {
+        referenceLine(x+x0,y+y0,-x+x0,y+y0,type);
+        referenceLine(y+x0,x+y0,-y+x0,x+y0,type);
+        referenceLine(y+x0,-x+y0,-y+x0,-x+y0,type);
+        referenceLine(x+x0,-y+y0,-x+x0,-y+y0,type);
+
+        y++;
+        if (radiusError<0) {
+            radiusError += 2 * y + 1;
+        } else {
+            x--;
+            radiusError += 2 * (y - x) + 1;
+        }
+    }
+}
+
+
+// reference filled drawRect: one reference line per row
+void referenceRect(unsigned int const x0,
+                   unsigned int const y0,
+                   unsigned int const width,
+                   unsigned int const height,
+                   FillType const     fill)
+{
+    int type = (fill==FILL_BLACK) ? 1:0;
+    for (unsigned int y = y0; y<y0+height; y++) {
+        referenceLine(x0,y,x0+(width-1),y,type);
+    }
+}
+
+
+// reference invertRect: the per-pixel loop Menu::drawSelected used
+void referenceInvert(int x0, int y0, int width, int height)
+{
+    for(int x = x0; x < x0 + width; x++ ) {
+        for(int y = y0; y < y0 + height; y++ ) {
+            if(lcd.getPixel(x, y) == 1) {
+                lcd.setPixel(x, y, 0);
+            }else{
+                lcd.setPixel(x, y, 1);
+            }
+        }
+    }
+}
+
+
+// reference blit: reads and writes the bitmap a pixel at a time
+void referenceBlit(const unsigned char *bitmap, int width, int height,
+                   int x0, int y0, RasterOp op)
+{
+    for (int x = 0; x < width; x++) {
+        for (int y = 0; y < height; y++) {
+            bool source = (bitmap[(y/8)*width + x] >> (y%8)) & 1;
+            bool pixel = lcd.getPixel(x0 + x, y0 + y);
+            switch (op) {
+                case OP_COPY: pixel = source; break;
+                case OP_OR:   pixel = pixel || source; break;
+                case OP_AND:  pixel = pixel && source; break;
+                default:      pixel = pixel != source; break;
+            }
+            lcd.setPixel(x0 + x, y0 + y, pixel);
+        }
+    }
+}
+
+
+// reference Bitmap::render: one int per pixel, a setPixel for each
+void referenceBitmap(const int *contents, int height, int width, int x0, int y0)
+{
+    for (int row = 0; row < height; row++) {
+        for (int column = 0; column < width; column++) {
+            lcd.setPixel(x0 + column, y0 + row, contents[row * width + column]);
+        }
+    }
+}
+
+
+// lines from the centre to every pixel on the edge of the screen
+void drawLineFan(bool reference, unsigned int type)
+{
+    for (int i = 0; i < WIDTH; i++) {
+        if (reference) {
+            referenceLine(WIDTH/2, HEIGHT/2, i, 0, type);
+            referenceLine(WIDTH/2, HEIGHT/2, i, HEIGHT-1, type);
+        } else {
+            lcd.drawLine(WIDTH/2, HEIGHT/2, i, 0, type);
+            lcd.drawLine(WIDTH/2, HEIGHT/2, i, HEIGHT-1, type);
+        }
+    }
+    for (int i = 0; i < HEIGHT; i++) {
+        if (reference) {
+            referenceLine(WIDTH/2, HEIGHT/2, 0, i, type);
+            referenceLine(WIDTH/2, HEIGHT/2, WIDTH-1, i, type);
+        } else {
+            lcd.drawLine(WIDTH/2, HEIGHT/2, 0, i, type);
+            lcd.drawLine(WIDTH/2, HEIGHT/2, WIDTH-1, i, type);
+        }
+    }
+}
+
+void drawSolidLines(bool reference)
+{
+    drawLineFan(reference, 1);
+}
+
+void drawDottedLines(bool reference)
+{
+    drawLineFan(reference, 2);
+}
+
+
+// circles of every radius that fits on the screen, at a few centres
+void drawCircles(bool reference, FillType fill)
+{
+    for (int radius = 1; radius < HEIGHT/2; radius += 3) {
+        for (int c = 0; c < 3; c++) {
+            unsigned int x = 14 + c * 28;
+            if (reference) {
+                referenceCircle(x, HEIGHT/2, radius, fill);
+            } else {
+                lcd.drawCircle(x, HEIGHT/2, radius, fill);
+            }
+        }
+    }
+}
+
+void drawBlackCircles(bool reference)
+{
+    drawCircles(reference, FILL_BLACK);
+}
+
+void drawWhiteCircles(bool reference)
+{
+    drawCircles(reference, FILL_WHITE);
+}
+
+
+// the boxes redrawn by the menus every frame
+void drawBoxes(bool reference)
+{
+    for (int i = 0; i < 8; i++) {
+        unsigned int x = i * 3;
+        unsigned int y = i * 2;
+        if (reference) {
+            referenceRect(x, y, 60 - x, 30 - y, FILL_BLACK);
+            referenceRect(x+1, y+1, 58 - x, 28 - y, FILL_WHITE);
+        } else {
+            lcd.drawRect(x, y, 60 - x, 30 - y, FILL_BLACK);
+            lcd.drawRect(x+1, y+1, 58 - x, 28 - y, FILL_WHITE);
+        }
+    }
+}
+
+
+// the selected option highlight of each menu row
+void drawMenuSelection(bool reference)
+{
+    for (int sel = 0; sel < 3; sel++) {
+        if (reference) {
+            referenceInvert(14, 15 + (sel*8), 56, 8);
+        } else {
+            lcd.invertRect(14, 15 + (sel*8), 56, 8);
+        }
+    }
+}
+
+
+// a 24x20 checked bitmap at every raster op and a few y offsets
+void drawBlits(bool reference)
+{
+    static unsigned char bitmap[3 * 24];
+    for (int i = 0; i < 3 * 24; i++) {
+        bitmap[i] = (i & 1) ? 0xAA : 0x55;
+    }
+    for (int op = OP_COPY; op <= OP_XOR; op++) {
+        for (int offset = 0; offset < 8; offset += 3) {
+            int x = op * 20 - 4;
+            int y = offset * 4 - 2;
+            if (reference) {
+                referenceBlit(bitmap, 24, 20, x, y, (RasterOp)op);
+            } else {
+                lcd.blit(bitmap, 24, 20, x, y, (RasterOp)op);
+            }
+        }
+    }
+}
+
+
+// a 24x24 bitmap (a ring) rendered at a row of positions
+void drawBitmaps(bool reference)
+{
+    static int contents[24 * 24];
+    static Bitmap *bitmap = NULL;
+    if (!bitmap) {
+        for (int i = 0; i < 24 * 24; i++) {
+            int dx = i % 24 - 12;
+            int dy = i / 24 - 12;
+            contents[i] = dx * dx + dy * dy < 144 && dx * dx + dy * dy > 49;
+        }
+        bitmap = new Bitmap(contents, 24, 24);
+    }
+    for (int n = 0; n < 6; n++) {
+        if (reference) {
+            referenceBitmap(contents, 24, 24, n * 13 - 6, n * 5);
+        } else {
+            bitmap->render(lcd, n * 13 - 6, n * 5);
+        }
+    }
+}
+
+
+// draws a case into a cleared (or filled) buffer
+void drawCase(const Case &test, bool reference)
+{
+    lcd.clear();
+    if (test.start_black) {
+        lcd.fillRect(0, 0, WIDTH, HEIGHT, true);
+    }
+    test.draw(reference);
+}
+
+
+// mean time to draw a case in microseconds, over the fastest batch of draws
+double timeCase(const Case &test, bool reference)
+{
+    double best = 0;
+    for (int batch = 0; batch < 5; batch++) {
+        double begin = nowUs();
+        for (int r = 0; r < g_repeat; r++) {
+            drawCase(test, reference);
+        }
+        double us = (nowUs() - begin) / g_repeat;
+        best = (batch == 0 || us < best) ? us : best;
+    }
+    return best;
+}
+
+
+int main(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--repeat" && i + 1 < argc) {
+            g_repeat = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: %s [--repeat N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (g_repeat < 1) {
+        fprintf(stderr, "--repeat must be at least 1\n");
+        return 1;
+    }
+
+    lcd.init();
+
+    Case cases[] = {
+        {"line_solid",    drawSolidLines,   false},
+        {"line_dotted",   drawDottedLines,  false},
+        {"circle_black",  drawBlackCircles, false},
+        {"circle_white",  drawWhiteCircles, true},
+        {"rect_boxes",    drawBoxes,        false},
+        {"menu_invert",   drawMenuSelection, false},
+        {"blit",          drawBlits,        true},
+        {"bitmap",        drawBitmaps,      false},
+    };
+
+    printf("%-13s %9s %9s %8s %8s\n", "case", "ref_us", "new_us", "speedup", "diff_px");
+
+    for (unsigned int i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const Case &test = cases[i];
+
+        // pixels where the library output differs from the reference
+        static bool expected[WIDTH][HEIGHT];
+        drawCase(test, true);
+        for (int x = 0; x < WIDTH; x++) {
+            for (int y = 0; y < HEIGHT; y++) {
+                expected[x][y] = lcd.getPixel(x, y);
+            }
+        }
+        drawCase(test, false);
+        int diff = 0;
+        for (int x = 0; x < WIDTH; x++) {
+            for (int y = 0; y < HEIGHT; y++) {
+                diff += lcd.getPixel(x, y) != expected[x][y];
+            }
+        }
+
+        double reference_us = timeCase(test, true);
+        double new_us = timeCase(test, false);
+        printf("%-13s %9.2f %9.2f %7.1fx %8d\n", test.name, reference_us, new_us,
+               reference_us / new_us, diff);
+    }
+    return 0;
+}
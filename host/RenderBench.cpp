@@ -0,0 +1,348 @@
+/*
+    Render benchmark
+
+    Renders the Data.h meshes and the Game cube grid at a fixed sweep of
+    rotations and scales, and reports the time per frame together with the
+    RenderStats counters. The sweep is deterministic, so the image hash of
+    each scenario can be compared between branches to check that an
+    optimisation did not change the output.
+
+    It then times N5110::refresh on its own, for frames where every byte
+    changes and for frames where only the fps counter changes, and reports
+    the bytes sent to the display per microsecond.
+
+    With --diff it renders nothing, and instead compares the frames that
+    two --dump runs wrote, one built with float and one with FIXED_POINT
+    (make golden). Each scenario has a tolerance, the most pixels a frame
+    may differ by between the two, and the bench fails if one is exceeded.
+
+    usage: bench [--steps N] [--repeat N] [--dump DIR] [--no-sort]
+                 [--diff DIR DIR]
+        --steps N      rotation steps per scale (default 36)
+        --repeat N     times each frame is timed, the fastest is kept (default 3)
+        --dump DIR     write every rendered frame to DIR as a PBM image
+        --no-sort      draw the meshes in file order instead of front to back
+        --diff DIR DIR compare the frames of two --dump runs, exits with 2
+                       if a scenario's tolerance is exceeded
+*/
+
+#include <string>
+#include <time.h>
+
+#include "mbed.h"
+#include "Sim.h"
+#include "N5110.h"
+#include "Utils.h"
+#include "Object.h"
+#include "Game.h"
+#include "Data.h"
+
+extern unsigned int game_space; // occupied cells of the puzzle grid (Game.cpp)
+
+struct Scenario{
+    const char *name;
+    ObjData *obj;          // mesh to render, NULL for the game grid
+    unsigned int space;    // occupied cells when rendering the game grid
+    int tolerance;         // pixels a frame may differ by between float and fixed point
+};
+
+struct Result{
+    unsigned int frames;
+    double total_us;
+    double min_us;
+    double max_us;
+    RenderStats stats;
+    unsigned int hash;
+};
+
+int g_steps = 36;
+int g_repeat = 3;
+const char *g_dump_dir = NULL;
+bool g_sort_faces = true;
+const char *g_diff_dirs[2] = {NULL, NULL};
+
+const float g_scales[] = {0.5, 1.0, 2.0, 4.0};
+
+
+double nowUs()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+
+// rotation used for step n of the sweep, covering all three axes
+Quaternion sweepRotation(int n)
+{
+    return ToQuaternion((n * 2.0 * PI) / g_steps,
+                        (n * 3.0 * PI) / g_steps,
+                        (n * 5.0 * PI) / g_steps);
+}
+
+
+// sends the lcd buffer to the simulated display and folds it into an FNV-1a hash
+void captureFrame(Result &result, const char *name, int frame)
+{
+    lcd.refresh();
+    const unsigned char *ram = simDisplayRam();
+    for (int i = 0; i < SIM_LCD_COLS * SIM_LCD_BANKS; i++) {
+        result.hash = (result.hash ^ ram[i]) * 16777619u;
+    }
+    if (g_dump_dir) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%s_%04d.pbm", g_dump_dir, name, frame);
+        simWritePbm(path);
+    }
+}
+
+
+void addFrame(Result &result, double us)
+{
+    result.frames++;
+    result.total_us += us;
+    result.min_us = result.frames == 1 || us < result.min_us ? us : result.min_us;
+    result.max_us = us > result.max_us ? us : result.max_us;
+    result.stats.faces          += g_render_stats.faces;
+    result.stats.faces_culled   += g_render_stats.faces_culled;
+    result.stats.faces_clipped  += g_render_stats.faces_clipped;
+    result.stats.pixels_tested  += g_render_stats.pixels_tested;
+    result.stats.pixels_written += g_render_stats.pixels_written;
+    result.stats.vertex_transforms += g_render_stats.vertex_transforms;
+    result.stats.spans_rejected += g_render_stats.spans_rejected;
+}
+
+
+// renders a mesh the same way as drawObject in main.cpp (sorted front to back)
+Result benchObject(const Scenario &scenario)
+{
+    Result result = Result();
+    result.hash = 2166136261u;
+    Object obj;
+    obj.setObjData(*scenario.obj);
+    Vector3 location = {42, 24, 0};
+    Vector3 relative_loc = {0, 0, 0};
+    Vector3 scale = {15, 15, 15};
+    int frame = 0;
+
+    for (unsigned int s = 0; s < sizeof(g_scales) / sizeof(g_scales[0]); s++) {
+        for (int n = 0; n < g_steps; n++) {
+            obj.setLocRotScale(location, relative_loc, sweepRotation(n), g_scales[s] * scale);
+
+            double best = 0;
+            for (int r = 0; r < g_repeat; r++) {
+                memset(&g_render_stats, 0, sizeof(g_render_stats));
+                double begin = nowUs();
+                lcd.clear();
+                Real const radius = obj.getRadius() * 15 * g_scales[s];
+                setDepthRange(-radius, radius);
+                clearDepth();
+                obj.draw(FILL_WHITE, g_sort_faces);
+                double us = nowUs() - begin;
+                best = (r == 0 || us < best) ? us : best;
+            }
+            addFrame(result, best);
+            captureFrame(result, scenario.name, frame++);
+        }
+    }
+    return result;
+}
+
+
+// renders the puzzle grid through Game::getFrame with a fixed set of occupied cells
+Result benchGame(const Scenario &scenario)
+{
+    Result result = Result();
+    result.hash = 2166136261u;
+    static Game game; // static like GlobalGame, Game does not initialise its button flags
+
+    for (int n = 0; n < g_steps; n++) {
+        double best = 0;
+        for (int r = 0; r < g_repeat; r++) {
+            // init resets the fps counter, so the printed fps never depends on timing
+            game.init(levels[0]);
+            game.setNewRotation(sweepRotation(n));
+            game_space = scenario.space;
+            memset(&g_render_stats, 0, sizeof(g_render_stats));
+            double begin = nowUs();
+            game.getFrame();
+            double us = nowUs() - begin;
+            best = (r == 0 || us < best) ? us : best;
+        }
+        addFrame(result, best);
+        captureFrame(result, scenario.name, n);
+    }
+    return result;
+}
+
+
+// times lcd.refresh for frames drawn by draw(), reporting the mean time per
+// refresh and the display bytes sent (commands and data)
+void benchRefresh(const char *name, void (*draw)(int frame))
+{
+    int const frames = g_steps * 4;
+    double total_us = 0;
+    unsigned long long begin_bytes = simLcdBytes();
+    for (int n = 0; n < frames; n++) {
+        draw(n);
+        double begin = nowUs();
+        lcd.refresh();
+        total_us += nowUs() - begin;
+    }
+    double bytes = simLcdBytes() - begin_bytes;
+    printf("%-13s %6d %9.2f %9.1f %9.2f\n", name, frames, total_us / frames,
+           bytes / frames, bytes / total_us);
+}
+
+
+// every byte of the buffer changes between frames
+void drawNoise(int /*frame*/)
+{
+    lcd.randomiseBuffer();
+}
+
+
+// only the fps counter in the corner changes, as in a paused game
+void drawFpsCounter(int frame)
+{
+    char text[8];
+    snprintf(text, sizeof(text), "%02d", frame % 100);
+    lcd.clear();
+    lcd.printString(text, 72, 0);
+}
+
+
+// reads a PBM written by simWritePbm (P4, one bit per pixel, rows padded to bytes)
+bool readPbm(const char *path, unsigned char *pixels)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        return false;
+    }
+    int width = 0;
+    int height = 0;
+    size_t const size = ((SIM_LCD_COLS + 7) / 8) * SIM_LCD_BANKS * 8;
+    bool const ok = fscanf(fp, "P4 %d %d", &width, &height) == 2 && fgetc(fp) == '\n' &&
+                    width == SIM_LCD_COLS && height == SIM_LCD_BANKS * 8 &&
+                    fread(pixels, 1, size, fp) == size;
+    fclose(fp);
+    return ok;
+}
+
+
+// compares the frames of a scenario in the two --diff directories, returns
+// false if a frame is missing or differs by more than the tolerance
+bool diffScenario(const Scenario &scenario)
+{
+    int const frames = scenario.obj ? g_steps * (int)(sizeof(g_scales) / sizeof(g_scales[0])) : g_steps;
+    size_t const size = ((SIM_LCD_COLS + 7) / 8) * SIM_LCD_BANKS * 8;
+    int differing = 0;  // frames with any differing pixel
+    int total = 0;
+    int most = 0;
+    for (int frame = 0; frame < frames; frame++) {
+        unsigned char pixels[2][size];
+        for (int d = 0; d < 2; d++) {
+            char path[256];
+            snprintf(path, sizeof(path), "%s/%s_%04d.pbm", g_diff_dirs[d], scenario.name, frame);
+            if (!readPbm(path, pixels[d])) {
+                fprintf(stderr, "could not read %s\n", path);
+                return false;
+            }
+        }
+        int pixels_differing = 0;
+        for (size_t i = 0; i < size; i++) {
+            for (unsigned char bits = pixels[0][i] ^ pixels[1][i]; bits; bits &= bits - 1) {
+                pixels_differing++;
+            }
+        }
+        differing += pixels_differing > 0;
+        total += pixels_differing;
+        most = pixels_differing > most ? pixels_differing : most;
+    }
+    bool const pass = most <= scenario.tolerance;
+    printf("%-13s %6d %9d %9.1f %9d %9d %s\n", scenario.name, frames, differing,
+           (double)total / frames, most, scenario.tolerance, pass ? "ok" : "FAIL");
+    return pass;
+}
+
+
+int main(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--steps" && i + 1 < argc) {
+            g_steps = atoi(argv[++i]);
+        } else if (arg == "--repeat" && i + 1 < argc) {
+            g_repeat = atoi(argv[++i]);
+        } else if (arg == "--dump" && i + 1 < argc) {
+            g_dump_dir = argv[++i];
+        } else if (arg == "--no-sort") {
+            g_sort_faces = false;
+        } else if (arg == "--diff" && i + 2 < argc) {
+            g_diff_dirs[0] = argv[++i];
+            g_diff_dirs[1] = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--steps N] [--repeat N] [--dump DIR] [--no-sort] "
+                    "[--diff DIR DIR]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (g_steps < 1 || g_repeat < 1) {
+        fprintf(stderr, "--steps and --repeat must be at least 1\n");
+        return 1;
+    }
+
+    // the tolerances are about 1.5 times the most pixels a frame differed by
+    // when they were set. Q16.16 rounds differently from float, so an edge
+    // can land a pixel over, and at the largest scale an edge that crosses
+    // the screen moves a whole row
+    Scenario scenarios[] = {
+        {"suzanne", &suzanne_object, 0, 100},
+        {"trophy",  &trophy_object,  0, 160},
+        {"torus",   &torus_object,   0, 240},
+        {"sphere",  &sphere_object,  0, 320},
+        {"cube",    &cube_object2,   0, 180},
+        {"grid_empty",   NULL, 0x0000000, 60},
+        {"grid_checker", NULL, 0x5555555, 120},
+        {"grid_full",    NULL, 0x7FFFFFF, 120},
+    };
+    int const scenario_count = sizeof(scenarios) / sizeof(scenarios[0]);
+
+    if (g_diff_dirs[0]) {
+        printf("%-13s %6s %9s %9s %9s %9s\n",
+               "scenario", "frames", "differ", "mean_px", "max_px", "limit");
+        bool pass = true;
+        for (int i = 0; i < scenario_count; i++) {
+            pass = diffScenario(scenarios[i]) && pass;
+        }
+        return pass ? 0 : 2;
+    }
+
+    lcd.init();
+
+    printf("%-13s %6s %9s %9s %9s %7s %7s %7s %7s %7s %9s %9s %8s\n",
+           "scenario", "frames", "mean_us", "min_us", "max_us",
+           "faces", "xforms", "culled", "clipped", "skipped", "tested", "written", "hash");
+
+    for (int i = 0; i < scenario_count; i++) {
+        const Scenario &scenario = scenarios[i];
+        Result result = scenario.obj ? benchObject(scenario) : benchGame(scenario);
+
+        // counters are reported as per-frame averages
+        double frames = result.frames;
+        printf("%-13s %6u %9.1f %9.1f %9.1f %7.1f %7.1f %7.1f %7.1f %7.1f %9.1f %9.1f %08x\n",
+               scenario.name, result.frames, result.total_us / frames,
+               result.min_us, result.max_us,
+               result.stats.faces / frames, result.stats.vertex_transforms / frames,
+               result.stats.faces_culled / frames,
+               result.stats.faces_clipped / frames, result.stats.spans_rejected / frames,
+               result.stats.pixels_tested / frames,
+               result.stats.pixels_written / frames, result.hash);
+    }
+
+    printf("\n%-13s %6s %9s %9s %9s\n", "refresh", "frames", "mean_us", "bytes", "bytes_us");
+    srand(1);
+    benchRefresh("full", drawNoise);
+    benchRefresh("fps_counter", drawFpsCounter);
+    return 0;
+}
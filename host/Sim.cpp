@@ -0,0 +1,643 @@
+/*
+    Host simulator
+
+    Implements the mbed stand-ins declared in host/mbed.h and a model of
+    the PCD8544 LCD controller driven through them.
+*/
+
+#include <vector>
+#include <errno.h>
+#include <fcntl.h>
+#include <termios.h>
+
+#include "mbed.h"
+#include "platform/mbed_assert.h"
+#include "Sim.h"
+
+// wiring of the lcd object in N5110.cpp: N5110 lcd(p8,p9,p10,p11,p13,p21)
+#define SIM_LCD_SCE p8
+#define SIM_LCD_DC p10
+#define SIM_LCD_MOSI p11
+
+#define SIM_PINS 64
+
+namespace {
+
+struct ScriptEvent {
+    unsigned int frame;
+    PinName pin;
+};
+
+// the simulator state lives in a function-local static so that it is ready
+// before any global peripheral objects (e.g. lcd) are constructed
+struct SimState {
+    int pin_level[SIM_PINS];
+    float analog[SIM_PINS];
+    std::vector<InterruptIn*> inputs;
+    std::vector<Ticker*> tickers;
+    unsigned long long now_us;
+
+    // PCD8544 controller model
+    unsigned char ram[SIM_LCD_BANKS][SIM_LCD_COLS];
+    int x_addr;
+    int y_addr;
+    bool extended;     // H bit of the function set command
+    bool vertical;     // V bit of the function set command
+    int display_mode;  // D and E bits of the display control command
+    int window_bytes;  // bytes written in the current SCE window
+    unsigned long long lcd_bytes;  // bytes written since start-up
+
+    // run configuration
+    unsigned int frames;
+    unsigned int max_frames;
+    unsigned long long frame_us;
+    const char *capture;
+    std::vector<ScriptEvent> script;
+    std::vector<PinName> held;
+    FILE *serial;        // SIM_SERIAL target, NULL when not set
+    bool serial_opened;  // SIM_SERIAL has been looked up
+
+    SimState()
+        :
+        inputs(),
+        tickers(),
+        now_us(0),
+        x_addr(0),
+        y_addr(0),
+        extended(false),
+        vertical(false),
+        display_mode(0),
+        window_bytes(0),
+        lcd_bytes(0),
+        frames(0),
+        max_frames(0),
+        frame_us(50000),
+        capture(getenv("SIM_CAPTURE")),
+        script(),
+        held(),
+        serial(NULL),
+        serial_opened(false)
+    {
+        for (int i = 0; i < SIM_PINS; i++) {
+            pin_level[i] = 0;
+            analog[i] = 0.5f;
+        }
+        memset(ram, 0, sizeof(ram));
+
+        const char *env = getenv("SIM_FRAMES");
+        if (env) {
+            max_frames = strtoul(env, NULL, 10);
+        }
+        env = getenv("SIM_FRAME_MS");
+        if (env) {
+            frame_us = strtoull(env, NULL, 10) * 1000;
+        }
+        env = getenv("SIM_SCRIPT");
+        while (env && *env) {
+            char *end;
+            ScriptEvent event;
+            event.frame = strtoul(env, &end, 10);
+            if (*end != ':') {
+                break;
+            }
+            event.pin = (PinName)strtol(end + 1, &end, 10);
+            script.push_back(event);
+            env = (*end == ',') ? end + 1 : end;
+        }
+    }
+};
+
+SimState &sim()
+{
+    static SimState state;
+    return state;
+}
+
+bool validPin(PinName pin)
+{
+    return pin >= 0 && pin < SIM_PINS;
+}
+
+// called when SCE goes high after a window that wrote more than one byte
+void frameComplete()
+{
+    SimState &s = sim();
+    s.frames++;
+
+    if (s.capture) {
+        char path[256];
+        snprintf(path, sizeof(path), s.capture, s.frames);
+        simWritePbm(path);
+    }
+    if (s.serial) {
+        fflush(s.serial);  // so a viewer sees each frame as it completes
+    }
+    if (s.max_frames != 0 && s.frames >= s.max_frames) {
+        exit(0);
+    }
+
+    simAdvance(s.frame_us);
+
+    // release the buttons pressed on the previous frame, then press the
+    // buttons scripted for this one
+    std::vector<PinName> released;
+    released.swap(s.held);
+    for (unsigned int i = 0; i < released.size(); i++) {
+        simSetPin(released[i], 0);
+    }
+    for (unsigned int i = 0; i < s.script.size(); i++) {
+        if (s.script[i].frame == s.frames) {
+            simSetPin(s.script[i].pin, 1);
+            s.held.push_back(s.script[i].pin);
+        }
+    }
+}
+
+void lcdCommand(unsigned char command)
+{
+    SimState &s = sim();
+    if ((command & 0xF8) == 0x20) { // function set
+        s.extended = command & 0x01;
+        s.vertical = command & 0x02;
+    } else if (!s.extended) {
+        if (command & 0x80) {
+            s.x_addr = (command & 0x7F) % SIM_LCD_COLS;
+        } else if ((command & 0xF8) == 0x40) {
+            s.y_addr = (command & 0x07) % SIM_LCD_BANKS;
+        } else if ((command & 0xFA) == 0x08) {
+            s.display_mode = ((command & 0x04) >> 1) | (command & 0x01);
+        }
+    }
+    // extended instructions (Vop, bias, temperature) do not affect the image
+}
+
+void lcdData(unsigned char data)
+{
+    SimState &s = sim();
+    s.ram[s.y_addr][s.x_addr] = data;
+
+    if (s.vertical) {
+        if (++s.y_addr == SIM_LCD_BANKS) {
+            s.y_addr = 0;
+            s.x_addr = (s.x_addr + 1) % SIM_LCD_COLS;
+        }
+    } else {
+        if (++s.x_addr == SIM_LCD_COLS) {
+            s.x_addr = 0;
+            s.y_addr = (s.y_addr + 1) % SIM_LCD_BANKS;
+        }
+    }
+}
+
+void setLevel(PinName pin, int value)
+{
+    SimState &s = sim();
+    if (!validPin(pin)) {
+        return;
+    }
+    int old_level = s.pin_level[pin];
+    s.pin_level[pin] = value ? 1 : 0;
+
+    if (pin == SIM_LCD_SCE) {
+        if (old_level == 1 && value == 0) {
+            s.window_bytes = 0;
+        } else if (old_level == 0 && value != 0 && s.window_bytes > 1) {
+            s.window_bytes = 0;
+            frameComplete();
+        }
+    }
+}
+
+// opens the SIM_SERIAL target on first use: "pty" creates a pseudo-terminal
+// and prints the path of its slave end, anything else is a file to write to
+FILE *serialTarget()
+{
+    SimState &s = sim();
+    if (s.serial_opened) {
+        return s.serial;
+    }
+    s.serial_opened = true;
+    const char *target = getenv("SIM_SERIAL");
+    if (!target) {
+        return NULL;
+    }
+    if (strcmp(target, "pty") == 0) {
+        int fd = posix_openpt(O_RDWR | O_NOCTTY);
+        if (fd < 0 || grantpt(fd) != 0 || unlockpt(fd) != 0) {
+            fprintf(stderr, "SIM_SERIAL: could not open a pty\n");
+            return NULL;
+        }
+        // raw mode, so bytes are passed through without translation
+        termios tio;
+        tcgetattr(fd, &tio);
+        cfmakeraw(&tio);
+        tcsetattr(fd, TCSANOW, &tio);
+        fprintf(stderr, "SIM_SERIAL: %s\n", ptsname(fd));
+        s.serial = fdopen(fd, "w");
+    } else {
+        s.serial = fopen(target, "wb");
+        if (!s.serial) {
+            fprintf(stderr, "SIM_SERIAL: could not open %s\n", target);
+        }
+    }
+    return s.serial;
+}
+
+} // namespace
+
+
+void simSetPin(PinName pin, int value)
+{
+    SimState &s = sim();
+    if (!validPin(pin)) {
+        return;
+    }
+    int old_level = s.pin_level[pin];
+    setLevel(pin, value);
+    for (unsigned int i = 0; i < s.inputs.size(); i++) {
+        if (s.inputs[i]->pin() == pin) {
+            s.inputs[i]->edge(old_level, s.pin_level[pin]);
+        }
+    }
+}
+
+int simGetPin(PinName pin)
+{
+    return validPin(pin) ? sim().pin_level[pin] : 0;
+}
+
+void simSetAnalog(PinName pin, float value)
+{
+    if (validPin(pin)) {
+        sim().analog[pin] = value;
+    }
+}
+
+void simAdvance(unsigned long long us)
+{
+    SimState &s = sim();
+    s.now_us += us;
+    // index loop as callbacks may attach or detach tickers
+    for (unsigned int i = 0; i < s.tickers.size(); i++) {
+        s.tickers[i]->service(s.now_us);
+    }
+}
+
+unsigned long long simTime()
+{
+    return sim().now_us;
+}
+
+unsigned int simFrameCount()
+{
+    return sim().frames;
+}
+
+unsigned long long simLcdBytes()
+{
+    return sim().lcd_bytes;
+}
+
+const unsigned char *simDisplayRam()
+{
+    return sim().ram[0];
+}
+
+bool simWritePbm(const char *path)
+{
+    SimState &s = sim();
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        return false;
+    }
+    fprintf(fp, "P4\n%d %d\n", SIM_LCD_COLS, SIM_LCD_BANKS * 8);
+    for (int y = 0; y < SIM_LCD_BANKS * 8; y++) {
+        unsigned char row[(SIM_LCD_COLS + 7) / 8] = {0};
+        for (int x = 0; x < SIM_LCD_COLS; x++) {
+            int pixel = (s.ram[y / 8][x] >> (y % 8)) & 1;
+            switch (s.display_mode) {
+                case 0: pixel = 0; break;          // display blank
+                case 1: pixel = 1; break;          // all segments on
+                case 3: pixel = !pixel; break;     // inverse video
+                default: break;                    // normal mode
+            }
+            row[x / 8] |= pixel << (7 - x % 8);
+        }
+        fwrite(row, 1, sizeof(row), fp);
+    }
+    fclose(fp);
+    return true;
+}
+
+
+void wait(float s)
+{
+    simAdvance((unsigned long long)(s * 1000000.0f));
+}
+
+void wait_ms(int ms)
+{
+    simAdvance((unsigned long long)ms * 1000);
+}
+
+void wait_us(int us)
+{
+    simAdvance(us);
+}
+
+uint32_t us_ticker_read()
+{
+    return (uint32_t)simTime();
+}
+
+// MBED_ASSERT failures in the headers taken from ../mbed (platform/Span.h)
+void mbed_assert_internal(const char *expr, const char *file, int line)
+{
+    fprintf(stderr, "assertion failed: %s, %s:%d\n", expr, file, line);
+    abort();
+}
+
+
+namespace mbed {
+
+SPI::SPI(PinName mosi, PinName /*miso*/, PinName /*sclk*/, PinName /*ssel*/)
+    :
+    _mosi(mosi),
+    _bits(8),
+    _mode(0),
+    _hz(1000000)
+{}
+
+void SPI::format(int bits, int mode)
+{
+    _bits = bits;
+    _mode = mode;
+}
+
+void SPI::frequency(int hz)
+{
+    _hz = hz;
+}
+
+int SPI::write(int value)
+{
+    if (_mosi == SIM_LCD_MOSI && simGetPin(SIM_LCD_SCE) == 0) {
+        sim().window_bytes++;
+        sim().lcd_bytes++;
+        if (simGetPin(SIM_LCD_DC)) {
+            lcdData(value);
+        } else {
+            lcdCommand(value);
+        }
+    }
+    return 0xFF; // MISO is not connected
+}
+
+int SPI::write(const char *tx_buffer, int tx_length, char *rx_buffer, int rx_length)
+{
+    // the pins cannot change during a block write to the display, so they
+    // are only checked once
+    if (_mosi == SIM_LCD_MOSI && rx_length == 0 && simGetPin(SIM_LCD_SCE) == 0) {
+        bool data = simGetPin(SIM_LCD_DC);
+        sim().window_bytes += tx_length;
+        sim().lcd_bytes += tx_length;
+        for (int i = 0; i < tx_length; i++) {
+            if (data) {
+                lcdData(tx_buffer[i]);
+            } else {
+                lcdCommand(tx_buffer[i]);
+            }
+        }
+        return tx_length;
+    }
+    int length = tx_length > rx_length ? tx_length : rx_length;
+    for (int i = 0; i < length; i++) {
+        int in = write(i < tx_length ? (unsigned char)tx_buffer[i] : 0xFF);
+        if (i < rx_length) {
+            rx_buffer[i] = in;
+        }
+    }
+    return length;
+}
+
+
+UARTSerial::UARTSerial(PinName tx, PinName /*rx*/, int baud)
+    :
+    _tx(tx),
+    _baud(baud),
+    _blocking(true)
+{}
+
+ssize_t UARTSerial::read(void * /*buffer*/, size_t /*size*/)
+{
+    return -EAGAIN;  // nothing is ever received
+}
+
+ssize_t UARTSerial::write(const void *buffer, size_t size)
+{
+    FILE *target = serialTarget();
+    if (target) {
+        fwrite(buffer, 1, size, target);
+    }
+    return size;
+}
+
+int UARTSerial::set_blocking(bool blocking)
+{
+    _blocking = blocking;
+    return 0;
+}
+
+bool UARTSerial::is_blocking() const
+{
+    return _blocking;
+}
+
+void UARTSerial::set_baud(int baud)
+{
+    _baud = baud;
+}
+
+
+DigitalOut::DigitalOut(PinName pin)
+    :
+    _pin(pin)
+{
+    setLevel(_pin, 0);
+}
+
+DigitalOut::DigitalOut(PinName pin, int value)
+    :
+    _pin(pin)
+{
+    setLevel(_pin, value);
+}
+
+void DigitalOut::write(int value)
+{
+    setLevel(_pin, value);
+}
+
+int DigitalOut::read()
+{
+    return simGetPin(_pin);
+}
+
+DigitalOut &DigitalOut::operator= (int value)
+{
+    write(value);
+    return *this;
+}
+
+DigitalOut::operator int()
+{
+    return read();
+}
+
+
+AnalogIn::AnalogIn(PinName pin)
+    :
+    _pin(pin)
+{}
+
+float AnalogIn::read()
+{
+    return validPin(_pin) ? sim().analog[_pin] : 0.0f;
+}
+
+unsigned short AnalogIn::read_u16()
+{
+    return (unsigned short)(read() * 65535.0f);
+}
+
+AnalogIn::operator float()
+{
+    return read();
+}
+
+
+InterruptIn::InterruptIn(PinName pin)
+    :
+    _pin(pin),
+    _rise(NULL),
+    _fall(NULL)
+{
+    sim().inputs.push_back(this);
+}
+
+InterruptIn::~InterruptIn()
+{
+    std::vector<InterruptIn*> &inputs = sim().inputs;
+    for (unsigned int i = 0; i < inputs.size(); i++) {
+        if (inputs[i] == this) {
+            inputs.erase(inputs.begin() + i);
+            break;
+        }
+    }
+}
+
+int InterruptIn::read()
+{
+    return simGetPin(_pin);
+}
+
+InterruptIn::operator int()
+{
+    return read();
+}
+
+void InterruptIn::rise(void (*func)())
+{
+    _rise = func;
+}
+
+void InterruptIn::fall(void (*func)())
+{
+    _fall = func;
+}
+
+void InterruptIn::mode(PinMode /*pull*/)
+{
+    // the simulated pins hold whatever level simSetPin gave them
+}
+
+void InterruptIn::edge(int old_level, int new_level)
+{
+    if (old_level == 0 && new_level == 1 && _rise) {
+        _rise();
+    } else if (old_level == 1 && new_level == 0 && _fall) {
+        _fall();
+    }
+}
+
+PinName InterruptIn::pin() const
+{
+    return _pin;
+}
+
+
+Ticker::Ticker()
+    :
+    _function(NULL),
+    _interval_us(0),
+    _next_us(0),
+    _one_shot(false)
+{
+    sim().tickers.push_back(this);
+}
+
+Ticker::~Ticker()
+{
+    std::vector<Ticker*> &tickers = sim().tickers;
+    for (unsigned int i = 0; i < tickers.size(); i++) {
+        if (tickers[i] == this) {
+            tickers.erase(tickers.begin() + i);
+            break;
+        }
+    }
+}
+
+void Ticker::attach(void (*func)(), float t)
+{
+    attach_us(func, (unsigned int)(t * 1000000.0f));
+}
+
+void Ticker::attach_us(void (*func)(), unsigned int t)
+{
+    _function = func;
+    _interval_us = t > 0 ? t : 1;
+    _next_us = simTime() + _interval_us;
+    _one_shot = false;
+}
+
+void Ticker::detach()
+{
+    _function = NULL;
+}
+
+void Ticker::service(unsigned long long now_us)
+{
+    // a callback may detach or re-attach, so re-check on every iteration
+    while (_function && _next_us <= now_us) {
+        void (*function)() = _function;
+        _next_us += _interval_us;
+        if (_one_shot) {
+            _function = NULL;
+        }
+        function();
+    }
+}
+
+
+void Timeout::attach(void (*func)(), float t)
+{
+    attach_us(func, (unsigned int)(t * 1000000.0f));
+}
+
+void Timeout::attach_us(void (*func)(), unsigned int t)
+{
+    Ticker::attach_us(func, t);
+    _one_shot = true;
+}
+
+} // namespace mbed
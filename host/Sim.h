@@ -0,0 +1,56 @@
+#ifndef SIM_H
+#define SIM_H
+
+#include "mbed.h"
+
+/*
+    Host simulator controls
+
+    The simulator models the PCD8544 controller behind the N5110 from the
+    bytes written over SPI and the D/C and SCE pin levels. A frame is
+    complete when a chip-select window writes more than one byte (as
+    N5110::refresh and clearRAM do, other writes send single bytes). On
+    every completed frame the virtual clock is advanced, due Ticker/Timeout
+    callbacks are fired and scripted inputs are applied.
+
+    The following environment variables configure a run:
+        SIM_CAPTURE   printf pattern for PBM captures, e.g. "out/f%05d.pbm"
+        SIM_FRAMES    exit(0) after this many frames (0 runs forever)
+        SIM_FRAME_MS  virtual time per frame in ms (default 50)
+        SIM_SCRIPT    button presses as "frame:pin" pairs, e.g. "3:17,9:28"
+                      (the pin is held for one frame and then released)
+        SIM_SERIAL    where UARTSerial output goes: a file path, or "pty" to
+                      create a pseudo-terminal (its path is printed to stderr)
+*/
+
+#define SIM_LCD_COLS 84
+#define SIM_LCD_BANKS 6
+
+// drive an input pin, firing InterruptIn edges
+void simSetPin(PinName pin, int value);
+
+// get the level of any pin (inputs and DigitalOut)
+int simGetPin(PinName pin);
+
+// set the value returned by AnalogIn::read for a pin (0.0 to 1.0)
+void simSetAnalog(PinName pin, float value);
+
+// advance the virtual clock and fire any due tickers
+void simAdvance(unsigned long long us);
+
+// virtual time since start-up in microseconds
+unsigned long long simTime();
+
+// number of complete frames received by the simulated display
+unsigned int simFrameCount();
+
+// number of bytes (commands and data) received by the simulated display
+unsigned long long simLcdBytes();
+
+// simulated display RAM in controller order (bank-major, 6 x 84 bytes)
+const unsigned char *simDisplayRam();
+
+// writes the current display contents as a binary PBM image
+bool simWritePbm(const char *path);
+
+#endif
@@ -0,0 +1,175 @@
+/*
+    Sprite encoder
+
+    Converts a binary PBM image (as written by the simulator's SIM_CAPTURE or
+    bench --dump) into a Sprite initialiser for N5110::drawSprite. The pixels
+    are stored bank by bank like the screen buffer, and run-length encoded
+    unless --raw is given. The output is C++ source for a header such as
+    Data.h.
+
+    usage: spriteenc [--raw] NAME FILE.pbm [X Y WIDTH HEIGHT]
+        --raw     write the bytes unencoded (SPRITE_RAW)
+        NAME      name of the Sprite, the data array is NAME_data
+        X Y WIDTH HEIGHT  part of the image to encode (default all of it)
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+std::vector<unsigned char> g_pixels;  // one byte per pixel, row-major
+int g_width = 0;
+int g_height = 0;
+
+
+// reads a P4 (binary) PBM, where a set bit is a black pixel
+bool readPbm(const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        return false;
+    }
+    char magic[3] = {0};
+    if (fscanf(fp, "%2s", magic) != 1 || strcmp(magic, "P4") != 0) {
+        fclose(fp);
+        return false;
+    }
+    // skip comments between the header fields
+    int values[2];
+    for (int i = 0; i < 2; i++) {
+        int c;
+        while ((c = fgetc(fp)) == '#' || c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+            if (c == '#') {
+                while ((c = fgetc(fp)) != '\n' && c != EOF) {}
+            }
+        }
+        ungetc(c, fp);
+        if (fscanf(fp, "%d", &values[i]) != 1) {
+            fclose(fp);
+            return false;
+        }
+    }
+    fgetc(fp);  // the single whitespace before the raster
+    g_width = values[0];
+    g_height = values[1];
+
+    int const row_bytes = (g_width + 7) / 8;
+    std::vector<unsigned char> row(row_bytes);
+    g_pixels.assign(g_width * g_height, 0);
+    for (int y = 0; y < g_height; y++) {
+        if (fread(&row[0], 1, row_bytes, fp) != (size_t)row_bytes) {
+            fclose(fp);
+            return false;
+        }
+        for (int x = 0; x < g_width; x++) {
+            g_pixels[y * g_width + x] = (row[x / 8] >> (7 - x % 8)) & 1;
+        }
+    }
+    fclose(fp);
+    return true;
+}
+
+
+// packs part of the image into bank rows of column bytes (top pixel in bit 0)
+std::vector<unsigned char> packBanks(int x0, int y0, int width, int height)
+{
+    int const banks = (height + 7) / 8;
+    std::vector<unsigned char> out(banks * width, 0);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (g_pixels[(y0 + y) * g_width + x0 + x]) {
+                out[(y / 8) * width + x] |= 1 << (y % 8);
+            }
+        }
+    }
+    return out;
+}
+
+
+// run-length encodes bytes in the format read by N5110::drawSprite: a header
+// h < 128 is followed by h+1 literal bytes, h >= 128 repeats the next byte
+// (h-128)+3 times
+std::vector<unsigned char> encodeRle(const std::vector<unsigned char> &in)
+{
+    std::vector<unsigned char> out;
+    size_t i = 0;
+    while (i < in.size()) {
+        size_t run = 1;
+        while (i + run < in.size() && in[i + run] == in[i] && run < 130) {
+            run++;
+        }
+        if (run >= 3) {
+            out.push_back(0x80 + (run - 3));
+            out.push_back(in[i]);
+            i += run;
+            continue;
+        }
+        // a literal packet lasts until the next run of 3 or more
+        size_t start = i;
+        while (i < in.size() && i - start < 128) {
+            if (i + 2 < in.size() && in[i] == in[i + 1] && in[i] == in[i + 2]) {
+                break;
+            }
+            i++;
+        }
+        out.push_back(i - start - 1);
+        out.insert(out.end(), in.begin() + start, in.begin() + i);
+    }
+    return out;
+}
+
+
+int main(int argc, char *argv[])
+{
+    bool raw = false;
+    std::vector<const char *> args;
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--raw") {
+            raw = true;
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+    if (args.size() != 2 && args.size() != 6) {
+        fprintf(stderr, "usage: %s [--raw] NAME FILE.pbm [X Y WIDTH HEIGHT]\n", argv[0]);
+        return 1;
+    }
+    const char *name = args[0];
+    if (!readPbm(args[1])) {
+        fprintf(stderr, "could not read %s as a binary (P4) PBM\n", args[1]);
+        return 1;
+    }
+
+    int x0 = 0;
+    int y0 = 0;
+    int width = g_width;
+    int height = g_height;
+    if (args.size() == 6) {
+        x0 = atoi(args[2]);
+        y0 = atoi(args[3]);
+        width = atoi(args[4]);
+        height = atoi(args[5]);
+    }
+    if (x0 < 0 || y0 < 0 || width < 1 || height < 1 || width > 255 || height > 255
+            || x0 + width > g_width || y0 + height > g_height) {
+        fprintf(stderr, "the sprite must be 1 to 255 pixels each way and inside the %dx%d image\n",
+                g_width, g_height);
+        return 1;
+    }
+
+    std::vector<unsigned char> banks = packBanks(x0, y0, width, height);
+    std::vector<unsigned char> data = raw ? banks : encodeRle(banks);
+
+    printf("// %s: %dx%d, %u bytes (%u unencoded)\n", name, width, height,
+           (unsigned int)data.size(), (unsigned int)banks.size());
+    printf("const unsigned char %s_data[%u] = {", name, (unsigned int)data.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        printf("%s0x%02X%s", i % 12 == 0 ? "\n    " : "", data[i], i + 1 < data.size() ? ", " : "");
+    }
+    printf("\n};\n");
+    printf("const Sprite %s = {%d, %d, %s, %s_data};\n", name, width, height,
+           raw ? "SPRITE_RAW" : "SPRITE_RLE", name);
+    return 0;
+}
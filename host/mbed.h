@@ -0,0 +1,309 @@
+/*
+    Host stand-in for mbed.h
+
+    Declares just enough of the mbed 2 API for lib/, lib2/ and main.cpp to
+    compile and run on a Linux host. The peripherals are backed by the
+    simulator in Sim.cpp, which models the PCD8544 controller of the N5110
+    so that every refreshed frame can be captured to a PBM file.
+
+    The LPC1768 has no asynchronous SPI, so SPI::transfer is only declared
+    when DEVICE_SPI_ASYNCH is defined (make SPI_ASYNCH=1). The simulated
+    transfer completes before it returns, as if the DMA was instantaneous.
+
+    The serial port is a UARTSerial, used through its FileHandle interface.
+    Its output goes to a file or a pseudo-terminal (SIM_SERIAL), every write
+    completes at once and nothing is received.
+*/
+
+#ifndef HOST_MBED_H
+#define HOST_MBED_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <math.h>
+#include <time.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#define MBED_MAJOR_VERSION 2
+#define MBED_MINOR_VERSION 0
+#define MBED_PATCH_VERSION 165
+#define TARGET_HOST_SIM 1
+
+// LPC1768 DIP pin names (p5 to p30) as used by the application
+enum PinName {
+    p5 = 5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16, p17, p18,
+    p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30,
+    LED1, LED2, LED3, LED4,
+    USBTX, USBRX,
+    NC = -1
+};
+
+enum PinMode {
+    PullUp,
+    PullDown,
+    PullNone,
+    OpenDrain,
+    PullDefault = PullDown
+};
+
+// CMSIS intrinsics used by the renderer (CLZ returns 32 for a zero input)
+inline unsigned int __clz(unsigned int value)
+{
+    return value == 0 ? 32 : __builtin_clz(value);
+}
+
+inline unsigned int __rbit(unsigned int value)
+{
+    unsigned int result = 0;
+    for (int i = 0; i < 32; i++) {
+        result = (result << 1) | (value & 1);
+        value >>= 1;
+    }
+    return result;
+}
+
+void wait(float s);
+void wait_ms(int ms);
+void wait_us(int us);
+
+// microseconds of virtual time, which only moves on between frames and in
+// waits, so a time slice never runs out within a frame on the host
+uint32_t us_ticker_read();
+
+namespace mbed {
+
+#if DEVICE_SPI_ASYNCH
+#define SPI_EVENT_ERROR       (1 << 1)
+#define SPI_EVENT_COMPLETE    (1 << 2)
+#define SPI_EVENT_RX_OVERFLOW (1 << 3)
+#define SPI_EVENT_ALL         (SPI_EVENT_ERROR | SPI_EVENT_COMPLETE | SPI_EVENT_RX_OVERFLOW)
+
+template <typename F>
+class Callback;
+
+/** Callback taking one argument, bound to a function or to a member function of an object */
+template <typename R, typename A0>
+class Callback<R(A0)>
+{
+public:
+    Callback()
+        :
+        _obj(NULL),
+        _thunk(NULL)
+    {}
+
+    Callback(R (*func)(A0))
+        :
+        _obj(NULL),
+        _thunk(&functionThunk)
+    {
+        memcpy(_method, &func, sizeof(func));
+    }
+
+    template <typename T>
+    Callback(T *obj, R (T::*method)(A0))
+        :
+        _obj(obj),
+        _thunk(&methodThunk<T>)
+    {
+        // member function pointers are at most two words on the supported hosts
+        typedef char method_fits[sizeof(method) <= sizeof(_method) ? 1 : -1] __attribute__((unused));
+        memcpy(_method, &method, sizeof(method));
+    }
+
+    R call(A0 a0) const
+    {
+        return _thunk(_obj, _method, a0);
+    }
+
+    R operator()(A0 a0) const
+    {
+        return call(a0);
+    }
+
+    operator bool() const
+    {
+        return _thunk != NULL;
+    }
+
+private:
+    static R functionThunk(void *obj, const char *method, A0 a0)
+    {
+        R (*func)(A0);
+        memcpy(&func, method, sizeof(func));
+        return func(a0);
+    }
+
+    template <typename T>
+    static R methodThunk(void *obj, const char *method, A0 a0)
+    {
+        R (T::*member)(A0);
+        memcpy(&member, method, sizeof(member));
+        return (static_cast<T *>(obj)->*member)(a0);
+    }
+
+    void *_obj;
+    char _method[2 * sizeof(void *)];
+    R (*_thunk)(void *, const char *, A0);
+};
+
+template <typename T, typename R, typename A0>
+Callback<R(A0)> callback(T *obj, R (T::*method)(A0))
+{
+    return Callback<R(A0)>(obj, method);
+}
+
+typedef Callback<void(int)> event_callback_t;
+#endif
+
+/** Serial Peripheral Interface master (bytes are fed to the simulated LCD) */
+class SPI
+{
+public:
+    SPI(PinName mosi, PinName miso, PinName sclk, PinName ssel = NC);
+    void format(int bits, int mode = 0);
+    void frequency(int hz = 1000000);
+    int write(int value);
+    int write(const char *tx_buffer, int tx_length, char *rx_buffer, int rx_length);
+
+#if DEVICE_SPI_ASYNCH
+    // 8 bit transfers only, the bytes are sent and the callback fired before returning
+    template <typename Type>
+    int transfer(const Type *tx_buffer, int tx_length, Type *rx_buffer, int rx_length,
+                 const event_callback_t &callback, int event = SPI_EVENT_COMPLETE)
+    {
+        int length = tx_length > rx_length ? tx_length : rx_length;
+        for (int i = 0; i < length; i++) {
+            int in = write(i < tx_length ? (unsigned char)tx_buffer[i] : 0xFF);
+            if (i < rx_length) {
+                rx_buffer[i] = in;
+            }
+        }
+        if (callback && (event & SPI_EVENT_COMPLETE)) {
+            callback.call(SPI_EVENT_COMPLETE);
+        }
+        return 0;
+    }
+#endif
+
+private:
+    PinName _mosi;
+    int _bits;
+    int _mode;
+    int _hz;
+};
+
+/** File-like device, the part of the interface that the application uses */
+class FileHandle
+{
+public:
+    virtual ~FileHandle() {}
+    virtual ssize_t read(void *buffer, size_t size) = 0;
+    virtual ssize_t write(const void *buffer, size_t size) = 0;
+    virtual int set_blocking(bool blocking) = 0;
+    virtual bool is_blocking() const = 0;
+};
+
+/** Buffered serial port, bytes written are sent to the target named by SIM_SERIAL (see Sim.h) */
+class UARTSerial : public FileHandle
+{
+public:
+    UARTSerial(PinName tx, PinName rx, int baud = 9600);
+    virtual ssize_t read(void *buffer, size_t size);
+    virtual ssize_t write(const void *buffer, size_t size);
+    virtual int set_blocking(bool blocking);
+    virtual bool is_blocking() const;
+    void set_baud(int baud);
+
+private:
+    PinName _tx;
+    int _baud;
+    bool _blocking;
+};
+
+/** Digital output, the simulator tracks the level of every pin */
+class DigitalOut
+{
+public:
+    DigitalOut(PinName pin);
+    DigitalOut(PinName pin, int value);
+    void write(int value);
+    int read();
+    DigitalOut &operator= (int value);
+    operator int();
+
+private:
+    PinName _pin;
+};
+
+/** Analog input, reads the value set with simSetAnalog (0.5 by default) */
+class AnalogIn
+{
+public:
+    AnalogIn(PinName pin);
+    float read();
+    unsigned short read_u16();
+    operator float();
+
+private:
+    PinName _pin;
+};
+
+/** Digital interrupt input, edges are generated with simSetPin */
+class InterruptIn
+{
+public:
+    InterruptIn(PinName pin);
+    ~InterruptIn();
+    int read();
+    operator int();
+    void rise(void (*func)());
+    void fall(void (*func)());
+    void mode(PinMode pull);
+
+    // called by the simulator when the pin level changes
+    void edge(int old_level, int new_level);
+    PinName pin() const;
+
+private:
+    PinName _pin;
+    void (*_rise)();
+    void (*_fall)();
+};
+
+/** Periodic callback driven by the simulator's virtual clock */
+class Ticker
+{
+public:
+    Ticker();
+    virtual ~Ticker();
+    void attach(void (*func)(), float t);
+    void attach_us(void (*func)(), unsigned int t);
+    void detach();
+
+    // called by the simulator to fire the callback when it is due
+    void service(unsigned long long now_us);
+
+protected:
+    void (*_function)();
+    unsigned long long _interval_us;
+    unsigned long long _next_us;
+    bool _one_shot;
+};
+
+/** One-shot callback driven by the simulator's virtual clock */
+class Timeout : public Ticker
+{
+public:
+    void attach(void (*func)(), float t);
+    void attach_us(void (*func)(), unsigned int t);
+};
+
+} // namespace mbed
+
+using namespace mbed;
+
+#endif
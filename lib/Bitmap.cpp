@@ -8,18 +8,43 @@ Bitmap::Bitmap(int const               *contents,
                unsigned int const       height,
                unsigned int const       width)
     :
-    _contents(std::vector<int>(height*width)),
+    _storage(std::vector<unsigned char>(((height + 7) / 8) * width)),
+    _packed(0),
+    _mask(0),
     _height(height),
     _width(width)
 {
-    // Perform a quick sanity check of the dimensions
-    if (_contents.size() != height * width) {
-        std::cerr << "Contents of bitmap has size " << _contents.size()
-                  << " pixels, but its dimensions were specified as "
-                  << width << " * " << height << " = " << width * height << std::endl;
+    // pack the row-major pixels into bank bytes, one bit per pixel
+    for (unsigned int row = 0; row < height; ++row) {
+        for (unsigned int column = 0; column < width; ++column) {
+            if (contents[row * width + column]) {
+                _storage[(row / 8) * width + column] |= 1 << (row % 8);
+            }
+        }
     }
+}
+
+Bitmap::Bitmap(unsigned char const *packed,
+               unsigned int const   height,
+               unsigned int const   width,
+               unsigned char const *mask)
+    :
+    _storage(),
+    _packed(packed),
+    _mask(mask),
+    _height(height),
+    _width(width)
+{}
 
-    for(unsigned int i = 0; i < height*width; ++i) _contents[i] = contents[i];
+/**
+ * @returns the packed pixels, wherever they are stored
+ */
+unsigned char const *Bitmap::packed() const
+{
+    if (_packed) {
+        return _packed;
+    }
+    return _storage.empty() ? 0 : &_storage[0];
 }
 
 /**
@@ -34,10 +59,11 @@ int Bitmap::get_pixel(unsigned int const row,
         std::cerr << "The requested pixel with index " << row << "," << column
                   << "is outside the bitmap dimensions: " << _width << ","
                   << _height << std::endl;
+        return 0;
     }
 
-    // Now return the pixel value, using row-major indexing
-    return _contents[row * _width + column];
+    // Now return the pixel value from its bank byte
+    return (packed()[(row / 8) * _width + column] >> (row % 8)) & 1;
 }
 
 /**
@@ -67,30 +93,15 @@ void Bitmap::print() const
  * @param[in] y0  The vertical position in pixels at which to render the bitmap
  *
  * @details Note that x0, y0 gives the location of the top-left of the bitmap on
- *          the screen.
+ *          the screen, and the bitmap is clipped to the screen.
+ *          White pixels are drawn too, unless the bitmap has a mask, in which
+ *          case only the pixels set in the mask are drawn.
  *          This function only updates the buffer on the screen.  You still need
  *          to refresh the screen in order to actually see the bitmap.
  */
 void Bitmap::render(N5110 &lcd,
-                    unsigned int const x0,
-                    unsigned int const y0) const
+                    int const x0,
+                    int const y0) const
 {
-    // Loop through each row of the bitmap image
-    for (unsigned int bitmap_row = 0; bitmap_row < _height; ++bitmap_row)
-    {
-        // Row index on the screen for rendering the row of pixels
-        unsigned int screen_row = y0 + bitmap_row;
-                
-        // Render each pixel in the row
-        for (unsigned int bitmap_col = 0; bitmap_col < _width; ++bitmap_col)
-        {
-            // Column index on the screen for rendering this pixel
-            int screen_col = x0 + bitmap_col;
-
-            // Find the required value of the pixel at the given location within
-            // the bitmap data and then write it to the LCD screen
-            int pixel = get_pixel(bitmap_row, bitmap_col);
-            lcd.setPixel(screen_col, screen_row, pixel);
-        }
-    }
-}
\ No newline at end of file
+    lcd.blit(packed(), _width, _height, x0, y0, OP_COPY, _mask);
+}
@@ -9,6 +9,12 @@ class N5110;
 /**
  * @brief  A black & white bitmap that can be rendered on an N5110 screen
  * @author Alex Valavanis <a.valavanis@leeds.ac.uk>
+ *
+ * @details Pixels are packed 1 bit each, in the same layout as the N5110 screen
+ *          buffer: (height+7)/8 banks of @c width bytes, one byte per column with
+ *          the top pixel of the bank in bit 0. Bitmaps built from packed data keep
+ *          a pointer to it, so a @c const array stays in flash and is never copied.
+ *          Rendering blits whole bytes into the screen buffer.
  * 
  * @code
   // First declare the pixel map data using '1' for black,
@@ -33,33 +39,49 @@ class N5110;
   
   // We can also print its values to the terminal
   sprite.print();
+
+  // The same sprite packed into bank bytes, with a mask that leaves the white
+  // pixels around the top of it transparent
+  static const unsigned char sprite_packed[] = {0xF0, 0xFA, 0x3F, 0xFA, 0xF0};
+  static const unsigned char sprite_mask[] = {0xF0, 0xFE, 0xFF, 0xFE, 0xF0};
+  Bitmap packed_sprite(sprite_packed, 8, 5, sprite_mask);
+  packed_sprite.render(lcd, 40, 6);
  * @endcode
  */
 class Bitmap
 {
 private:
     /**
-     * @brief The contents of the drawing, with pixels stored in row-major order
-     * @details '1' represents a black pixel; '0' represents white
+     * @brief Packed pixels owned by the bitmap, when it was built from an int array
      */
-    std::vector<int> _contents;
+    std::vector<unsigned char> _storage;
+
+    unsigned char const *_packed;  ///< Packed pixels in flash (NULL when _storage is used)
+    unsigned char const *_mask;    ///< Packed transparency mask, NULL for an opaque bitmap
     
     unsigned int _height; ///< The height of the drawing in pixels
     unsigned int _width;  ///< The width of the drawing in pixels
+
+    unsigned char const *packed() const;
     
 public:
     Bitmap(int const          *contents,
            unsigned int const  height,
            unsigned int const  width);
 
+    Bitmap(unsigned char const *packed,
+           unsigned int const   height,
+           unsigned int const   width,
+           unsigned char const *mask = 0);
+
     int get_pixel(unsigned int const row,
                   unsigned int const column) const;
 
     void print() const;
 
     void render(N5110 &lcd,
-                unsigned int const x0,
-                unsigned int const y0) const;
+                int const x0,
+                int const y0) const;
 };
 
 #endif // BITMAP_H
\ No newline at end of file
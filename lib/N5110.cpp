@@ -1,6 +1,13 @@
 #include "mbed.h"
 #include "N5110.h"
 
+// byte of the screen buffer holding 8 pixels of column x in a bank
+#ifdef N5110_BANK_MAJOR
+#define BUFFER_BYTE(x, bank) buffer[bank][x]
+#else
+#define BUFFER_BYTE(x, bank) buffer[x][bank]
+#endif
+
 // overloaded constructor includes power pin - LCD Vcc connected to GPIO pin
 // this constructor works fine with LPC1768 - enough current sourced from GPIO
 // to power LCD. Doesn't work well with K64F.
@@ -17,7 +24,13 @@ N5110::N5110(PinName const pwrPin,
     _pwr(new DigitalOut(pwrPin)),
     _sce(new DigitalOut(scePin)),
     _rst(new DigitalOut(rstPin)),
-    _dc(new DigitalOut(dcPin))
+    _dc(new DigitalOut(dcPin)),
+    _flushing(false),
+    _frame_open(false),
+    _mirror(NULL),
+    _mirror_frames(0),
+    _mirror_chunk_len(0),
+    _mirror_short(false)
 {}
 
 // overloaded constructor does not include power pin - LCD Vcc must be tied to +3V3
@@ -35,7 +48,13 @@ N5110::N5110(PinName const scePin,
     _pwr(NULL), // pwr not needed so null it to be safe
     _sce(new DigitalOut(scePin)),
     _rst(new DigitalOut(rstPin)),
-    _dc(new DigitalOut(dcPin))
+    _dc(new DigitalOut(dcPin)),
+    _flushing(false),
+    _frame_open(false),
+    _mirror(NULL),
+    _mirror_frames(0),
+    _mirror_chunk_len(0),
+    _mirror_short(false)
 {}
 
 
@@ -196,6 +215,7 @@ void N5110::initSPI()
 // send a command to the display
 void N5110::sendCommand(unsigned char command)
 {
+    waitForFlush();
     _dc->write(0);  // set DC low for command
     _sce->write(0); // set CE low to begin frame
     _spi->write(command);  // send command
@@ -208,6 +228,7 @@ void N5110::sendCommand(unsigned char command)
 // be the default mode.
 void N5110::sendData(unsigned char data)
 {
+    waitForFlush();
     _sce->write(0);   // set CE low to begin frame
     _spi->write(data);
     _sce->write(1);  // set CE high to end frame (expected for transmission of single byte)
@@ -216,10 +237,13 @@ void N5110::sendData(unsigned char data)
 // this function writes 0 to the 504 bytes to clear the RAM
 void N5110::clearRAM()
 {
+    waitForFlush();
+    memset(front_buffer, 0, sizeof(front_buffer));  // the display will match an empty buffer
+    _mirror_frames = 0;  // a delta from the cleared RAM would not match the mirror, send a key frame next
     _sce->write(0);  //set CE low to begin frame
-    for(int i = 0; i < WIDTH * HEIGHT; i++) { // 48 x 84 bits = 504 bytes
-        _spi->write(0x00);  // send 0's
-    }
+    // send 504 0's in one block, the address wraps around so all of the RAM is
+    // cleared whichever address it starts from
+    _spi->write((const char *)front_buffer, sizeof(front_buffer), NULL, 0);
     _sce->write(1); // set CE high to end frame
 }
 
@@ -234,6 +258,17 @@ void N5110::setXYAddress(unsigned int const x,
     }
 }
 
+// sets the XY address in RAM from within a frame that is already in progress
+// (CE low), the DC line is set back to data afterwards
+void N5110::sendAddress(unsigned int const x,
+                        unsigned int const bank)
+{
+    _dc->write(0);
+    _spi->write(0b10000000 | x);
+    _spi->write(0b01000000 | bank);
+    _dc->write(1);
+}
+
 // These functions are used to set, clear and get the value of pixels in the display
 // Pixels are addressed in the range of 0 to 47 (y) and 0 to 83 (x).  The refresh()
 // function must be called after set and clear in order to update the display
@@ -243,8 +278,8 @@ void N5110::setPixel(unsigned int const x,
 {
     if (x<WIDTH && y<HEIGHT) {  // check within range
         // calculate bank and shift 1 to required position in the data byte
-        if(state) buffer[x][y/8] |= (1 << y%8);
-        else      buffer[x][y/8] &= ~(1 << y%8);
+        if(state) BUFFER_BYTE(x, y/8) |= (1 << y%8);
+        else      BUFFER_BYTE(x, y/8) &= ~(1 << y%8);
     }
 }
 
@@ -253,7 +288,7 @@ void N5110::clearPixel(unsigned int const x,
 {
     if (x<WIDTH && y<HEIGHT) {  // check within range
         // calculate bank and shift 1 to required position (using bit clear)
-        buffer[x][y/8] &= ~(1 << y%8);
+        BUFFER_BYTE(x, y/8) &= ~(1 << y%8);
     }
 }
 
@@ -263,7 +298,7 @@ int N5110::getPixel(unsigned int const x,
     if (x<WIDTH && y<HEIGHT) {  // check within range
         // return relevant bank and mask required bit
 
-        int pixel = (int) buffer[x][y/8] & (1 << y%8);
+        int pixel = (int) BUFFER_BYTE(x, y/8) & (1 << y%8);
 
         if (pixel)
             return 1;
@@ -276,21 +311,246 @@ int N5110::getPixel(unsigned int const x,
 }
 
 // function to refresh the display
+// buffer is drawn to while front_buffer holds what the display RAM contains, in
+// the order it is sent. Only the bytes that differ between them are sent.
 void N5110::refresh()
 {
-    setXYAddress(0,0);  // important to set address back to 0,0 before refreshing display
-    // address auto increments after printing string, so buffer[0][0] will not coincide
-    // with top-left pixel after priting string
-
+    waitForFlush();  // front_buffer can't be changed while it is being sent
+    if (_mirror) {
+        sendMirror();  // before front_buffer is updated, it holds the previous frame
+    }
+    
     _sce->write(0);  //set CE low to begin frame
-
-    for(int j = 0; j < BANKS; j++) {  // be careful to use correct order (j,i) for horizontal addressing
+    
+    _dc->write(0);
+    _spi->write(0b00100000);  // basic instruction (horizontal addressing)
+    _dc->write(1);
+    
+#if DEVICE_SPI_ASYNCH
+    // everything from the first to the last changed byte is copied to front_buffer
+    // and sent in one transfer while the next frame is being drawn
+    int first = -1;
+    int last = -1;
+    for(int j = 0; j < BANKS; j++) {
         for(int i = 0; i < WIDTH; i++) {
-            _spi->write(buffer[i][j]);  // send buffer
+            if (BUFFER_BYTE(i, j) != front_buffer[j][i]) {
+                first = first < 0 ? j * WIDTH + i : first;
+                last = j * WIDTH + i;
+            }
         }
     }
+    
+    if (first < 0) {
+        endRefresh();
+        return;
+    }
+    copyToFront(first, last - first + 1);
+    sendAddress(first % WIDTH, first / WIDTH);
+    _frame_open = true;
+    _flushing = true;
+    _spi->transfer(&front_buffer[0][0] + first, last - first + 1, (unsigned char *)NULL, 0,
+                   callback(this, &N5110::flushComplete));
+#else
+    // the range of changed columns in each bank is sent, each range needs its own
+    // 2 byte address so the whole buffer is sent instead when that is shorter
+    // (e.g. when a 3D frame has been drawn)
+    int first[BANKS];  // first and last changed column of each bank (-1 if unchanged)
+    int last[BANKS];
+    int partial_bytes = 0;
+    
+    for(int j = 0; j < BANKS; j++) {
+        first[j] = -1;
+        last[j] = -1;
+        for(int i = 0; i < WIDTH; i++) {
+            if (BUFFER_BYTE(i, j) != front_buffer[j][i]) {
+                first[j] = first[j] < 0 ? i : first[j];
+                last[j] = i;
+            }
+        }
+        if (first[j] >= 0) {
+            partial_bytes += 2 + last[j] - first[j] + 1;
+        }
+    }
+    
+    if (partial_bytes >= 2 + WIDTH * BANKS) {
+        // important to set address back to 0,0 before refreshing display
+        // address auto increments after printing string, so buffer[0][0] will not coincide
+        // with top-left pixel after priting string
+        first[0] = 0;
+        last[0] = WIDTH * BANKS - 1;  // horizontal addressing wraps onto the next bank
+        for(int j = 1; j < BANKS; j++) {
+            first[j] = -1;
+        }
+    }
+    
+    for(int j = 0; j < BANKS; j++) {
+        if (first[j] < 0) {
+            continue;
+        }
+        // each range is sent with one block write from front_buffer, which is in
+        // the order of horizontal addressing
+        int const start = j * WIDTH + first[j];
+        int const length = last[j] - first[j] + 1;
+        copyToFront(start, length);
+        sendAddress(first[j], j);
+        _spi->write((const char *)&front_buffer[0][0] + start, length, NULL, 0);  // send buffer
+    }
+    endRefresh();
+#endif
+}
+
+// copies a range of the buffer to front_buffer, start and length count bytes
+// in the order they are sent (bank by bank)
+void N5110::copyToFront(int const start,
+                        int const length)
+{
+#ifdef N5110_BANK_MAJOR
+    memcpy(&front_buffer[0][0] + start, &buffer[0][0] + start, length);  // same layout
+#else
+    for(int n = start; n < start + length; n++) {
+        front_buffer[n / WIDTH][n % WIDTH] = buffer[n % WIDTH][n / WIDTH];
+    }
+#endif
+}
+
+// ends the frame started by refresh, leaving the address at 0,0 whichever
+// parts of the buffer were sent
+void N5110::endRefresh()
+{
+    sendAddress(0, 0);
     _sce->write(1); // set CE high to end frame
+    _frame_open = false;
+}
+
+#if DEVICE_SPI_ASYNCH
+// called (from interrupt) when the transfer started by refresh has completed,
+// the frame is ended later by waitForFlush as that needs blocking SPI writes
+void N5110::flushComplete(int /*event*/)
+{
+    _flushing = false;
+}
+#endif
 
+// waits until the front buffer has been sent and ends its frame, the buffer can
+// be drawn to while a refresh is in progress but the display can't be sent
+// anything else
+void N5110::waitForFlush()
+{
+    while (_flushing) {
+    }
+    if (_frame_open) {
+        endRefresh();
+    }
+}
+
+void N5110::mirrorTo(FileHandle *port)
+{
+    _mirror = port;
+    _mirror_frames = 0;  // start with a key frame
+}
+
+// byte n of the frame in display order, or of its difference from the
+// previous frame (front_buffer) for a delta frame
+unsigned char N5110::mirrorByte(int const  n,
+                                bool const key) const
+{
+    unsigned char const byte = BUFFER_BYTE(n % WIDTH, n / WIDTH);
+    return key ? byte : byte ^ front_buffer[n / WIDTH][n % WIDTH];
+}
+
+// run-length encodes a mirror frame in the drawSprite format and returns its
+// length. Only sends the bytes when send is set, so the packet length can be
+// found first without a buffer for the encoded frame
+int N5110::encodeMirror(bool const key,
+                        bool const send)
+{
+    int const total = WIDTH * BANKS;
+    int length = 0;
+    int i = 0;
+    while (i < total) {
+        unsigned char const value = mirrorByte(i, key);
+        int run = 1;
+        while (i + run < total && run < 130 && mirrorByte(i + run, key) == value) {
+            run++;
+        }
+        if (run >= 3) {  // repeat packet
+            if (send) {
+                putMirror(0x80 + (run - 3));
+                putMirror(value);
+            }
+            length += 2;
+            i += run;
+            continue;
+        }
+
+        // literal packet, up to the next run of 3 or more
+        int const start = i;
+        while (i < total && i - start < 128) {
+            unsigned char const next = mirrorByte(i, key);
+            if (i + 2 < total && mirrorByte(i + 1, key) == next && mirrorByte(i + 2, key) == next) {
+                break;
+            }
+            i++;
+        }
+        if (send) {
+            putMirror(i - start - 1);
+            for (int n = start; n < i; n++) {
+                putMirror(mirrorByte(n, key));
+            }
+        }
+        length += 1 + (i - start);
+    }
+    return length;
+}
+
+// sends the buffer to the mirror port as a key or delta frame packet
+void N5110::sendMirror()
+{
+    bool const key = (_mirror_frames % N5110_MIRROR_KEY_INTERVAL) == 0;
+    _mirror_frames++;
+    _mirror_short = false;
+
+    // Fletcher-16 of the new frame, so the viewer can check what it rebuilt
+    unsigned int sum1 = 0;
+    unsigned int sum2 = 0;
+    for (int n = 0; n < WIDTH * BANKS; n++) {
+        sum1 = (sum1 + mirrorByte(n, true)) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+
+    int const length = encodeMirror(key, false);
+    putMirror(0xA5);
+    putMirror(0x5A);
+    putMirror(key ? 'K' : 'D');
+    putMirror(length & 0xFF);
+    putMirror(length >> 8);
+    encodeMirror(key, true);
+    putMirror(sum1);
+    putMirror(sum2);
+    flushMirror();
+    if (_mirror_short) {
+        _mirror_frames = 0;  // the viewer has lost its previous frame, send a key frame next
+    }
+}
+
+// adds a byte to the mirror packet, writing the chunk when it is full
+void N5110::putMirror(unsigned char const byte)
+{
+    _mirror_chunk[_mirror_chunk_len++] = byte;
+    if (_mirror_chunk_len == N5110_MIRROR_CHUNK) {
+        flushMirror();
+    }
+}
+
+// writes the gathered bytes of the mirror packet, dropping them once a write
+// has fallen short so that a partial packet isn't followed by more of it
+void N5110::flushMirror()
+{
+    if (!_mirror_short && _mirror_chunk_len > 0) {
+        ssize_t const written = _mirror->write(_mirror_chunk, _mirror_chunk_len);
+        _mirror_short = written != _mirror_chunk_len;
+    }
+    _mirror_chunk_len = 0;
 }
 
 // fills the buffer with random bytes.  Can be used to test the display.
@@ -300,13 +560,21 @@ void N5110::randomiseBuffer()
     int i,j;
     for(j = 0; j < BANKS; j++) {  // be careful to use correct order (j,i) for horizontal addressing
         for(i = 0; i < WIDTH; i++) {
-            buffer[i][j] = rand()%256;  // generate random byte
+            BUFFER_BYTE(i, j) = rand()%256;  // generate random byte
         }
     }
 
 }
 
 // function to print 5x7 font
+// columns of a character in font5x7 (offset by 32 relative to ASCII, each character
+// is 5 pixels wide), characters outside the font are printed as spaces
+static unsigned char const *glyphColumns(char const c)
+{
+    unsigned char const code = c;
+    return &font5x7[(code >= 32 && code < 128 ? code - 32 : 0) * 5];
+}
+
 void N5110::printChar(char const          c,
                       unsigned int const  x,
                       unsigned int const  y)
@@ -317,43 +585,54 @@ void N5110::printChar(char const          c,
             int pixel_x = x+i;
             if (pixel_x > WIDTH-1)  // ensure pixel isn't outside the buffer size (0 - 83)
                 break;
-            buffer[pixel_x][y] = font5x7[(c - 32)*5 + i];
-            // array is offset by 32 relative to ASCII, each character is 5 pixels wide
+            BUFFER_BYTE(pixel_x, y) = glyphColumns(c)[i];
         }
 
     }
 }
 
 // function to print string at specified position
-void N5110::printString(const char         *str,
-                        unsigned int const  x,
-                        unsigned int const  y)
+void N5110::printString(const char *str,
+                        int const   x,
+                        int const   y)
 {
-    if (y<BANKS*8) {  // check if printing in range of y
-    
-        int n = 0 ; // counter for number of characters in string
-        // loop through string and print character
-        while(*str) {
-
-            // writes the character bitmap data to the buffer, so that
-            // text and pixels can be displayed at the same time
-            for (int i = 0; i < 5 ; i++ ) {
-                int pixel_x = x+i+n*6;
-                if (pixel_x > WIDTH-1){ // ensure pixel isn't outside the buffer size (0 - 83)
-                    break;
-                }
-                // To draw the text at any y pixel, the text is split up into top and bottom banks
-                // The top bank is bit shifted down by y % 8 and the bottom bank is bit shifted
-                // up by 8 - (y % 8), bitwaise OR is performed to make the background transparent
-                buffer[pixel_x][(y/8)] = buffer[pixel_x][(y/8)] | (font5x7[(*str - 32)*5 + i] << (y%8));
-                buffer[pixel_x][(y/8)+1] = buffer[pixel_x][(y/8)+1] | (font5x7[(*str - 32)*5 + i] >> (8-(y%8)));
+    // To draw the text at any y pixel, the text is split up into top and bottom banks
+    // The top bank is bit shifted down by y % 8 and the bottom bank is bit shifted
+    // up by 8 - (y % 8), bitwise OR is performed to make the background transparent.
+    // The shift and the banks are the same for every column, so they are worked out
+    // once for the string (y % 8 is rounded towards minus infinity for negative y)
+    int const shift = ((y % 8) + 8) % 8;
+    int const top = (y - shift) / 8;
+    int const bottom = top + 1;
+    bool const draw_top = top >= 0 && top < BANKS;
+    bool const draw_bottom = shift != 0 && bottom >= 0 && bottom < BANKS;
+    if (!draw_top && !draw_bottom) {
+        return;
+    }
+
+    // loop through string and print character, until the right edge of the screen
+    for (int char_x = x; *str && char_x < WIDTH; str++, char_x += 6) {
+        unsigned char const *glyph = glyphColumns(*str);
+        for (int i = 0; i < 5 ; i++ ) {
+            int const pixel_x = char_x + i;
+            if (pixel_x < 0 || pixel_x > WIDTH-1) { // ensure pixel isn't outside the buffer size (0 - 83)
+                continue;
+            }
+            if (draw_top) {
+                BUFFER_BYTE(pixel_x, top) |= glyph[i] << shift;
+            }
+            if (draw_bottom) {
+                BUFFER_BYTE(pixel_x, bottom) |= glyph[i] >> (8 - shift);
             }
-            str++;  // go to next character in string
-            n++;    // increment index
         }
     }
 }
 
+int N5110::stringWidth(char const *str) const
+{
+    return strlen(str) * 6;  // 5 columns and a gap per character
+}
+
 // function to clear the screen buffer
 void N5110::clear()
 {
@@ -382,6 +661,10 @@ void N5110:: drawCircle(unsigned int const x0,
     int x = radius;
     int y = 0;
     int radiusError = 1-x;
+    // the centre can be near an edge, so the spans are clipped by hSpan
+    int const cx = static_cast<int>(x0);
+    int const cy = static_cast<int>(y0);
+    bool const state = (fill==FILL_BLACK);  // black or white fill
 
     while(x >= y) {
 
@@ -395,24 +678,30 @@ void N5110:: drawCircle(unsigned int const x0,
             setPixel( y + x0, -x + y0,true);
             setPixel( x + x0, -y + y0,true);
             setPixel(-x + x0, -y + y0,true);
-        } else {  // drawing filled circle, so draw lines between points at same y value
-
-            int type = (fill==FILL_BLACK) ? 1:0;  // black or white fill
-
-            drawLine(x+x0,y+y0,-x+x0,y+y0,type);
-            drawLine(y+x0,x+y0,-y+x0,x+y0,type);
-            drawLine(y+x0,-x+y0,-y+x0,-x+y0,type);
-            drawLine(x+x0,-y+y0,-x+x0,-y+y0,type);
+        } else {  // drawing filled circle, so fill spans between points at same y value
+            hSpan(cx-x,cx+x,cy+y,state);
+            hSpan(cx-x,cx+x,cy-y,state);
         }
 
         y++;
         if (radiusError<0) {
             radiusError += 2 * y + 1;
         } else {
+            // rows y0+-x only get wider while x stays the same, so they are
+            // filled once, with their widest span, before x moves in
+            if (fill != FILL_TRANSPARENT) {
+                hSpan(cx-(y-1),cx+(y-1),cy+x,state);
+                hSpan(cx-(y-1),cx+(y-1),cy-x,state);
+            }
             x--;
             radiusError += 2 * (y - x) + 1;
         }
     }
+    // the last rows y0+-x reached when the loop ends
+    if (fill != FILL_TRANSPARENT && x == y - 1) {
+        hSpan(cx-(y-1),cx+(y-1),cy+x,state);
+        hSpan(cx-(y-1),cx+(y-1),cy-x,state);
+    }
 
 }
 
@@ -422,47 +711,52 @@ void N5110::drawLine(unsigned int const x0,
                      unsigned int const y1,
                      unsigned int const type)
 {
-    // Note that the ranges can be negative so we have to turn the input values
-    // into signed integers first
-    int const y_range = static_cast<int>(y1) - static_cast<int>(y0);
-    int const x_range = static_cast<int>(x1) - static_cast<int>(x0);
-
-    // if dotted line, set step to 2, else step is 1
-    unsigned int const step = (type==2) ? 2:1;
+    // Bresenham's line algorithm (integer only), giving the same pixels as the
+    // interpolation from x0,y0 it replaced: the minor axis is truncated towards
+    // the start point. Note that the coordinates can be negative so we have to
+    // turn the input values into signed integers first
+    int xa = static_cast<int>(x0);
+    int ya = static_cast<int>(y0);
+    int xb = static_cast<int>(x1);
+    int yb = static_cast<int>(y1);
 
     // make sure we loop over the largest range to get the most pixels on the display
-    // for instance, if drawing a vertical line (x_range = 0), we need to loop down the y pixels
+    // for instance, if drawing a vertical line, we need to loop down the y pixels
     // or else we'll only end up with 1 pixel in the x column
-    if ( abs(x_range) > abs(y_range) ) {
-
-        // ensure we loop from smallest to largest or else for-loop won't run as expected
-        unsigned int const start = x_range > 0 ? x0:x1;
-        unsigned int const stop =  x_range > 0 ? x1:x0;
-
-        // loop between x pixels
-        for (unsigned int x = start; x<= stop ; x+=step) {
-            // do linear interpolation
-            int const dx = static_cast<int>(x)-static_cast<int>(x0);
-            unsigned int const y = y0 + y_range * dx / x_range;
+    bool const steep = abs(yb - ya) >= abs(xb - xa);
+    if (steep) {  // swap the axes so that x is always the longest one
+        int t = xa; xa = ya; ya = t;
+        t = xb; xb = yb; yb = t;
+    }
 
+    int const dx = abs(xb - xa);
+    int const dy = abs(yb - ya);
+    int const x_step = xa <= xb ? 1 : -1;
+    int const y_step = ya <= yb ? 1 : -1;
+    // if dotted line, set step to 2, else step is 1
+    int const step = (type==2) ? 2:1;
+    // the dots are an even distance from the smaller end of the line, whichever
+    // way round the points are given, so a line drawn from its larger end with
+    // an odd length starts one pixel in
+    int n = (step == 2 && xa > xb) ? dx % 2 : 0;
+    int y_offset = dx > 0 ? dy * n / dx : 0;
+    int error = dy * n - y_offset * dx;  // remainder of dy * n / dx
+
+    for (; n <= dx; n += step) {
+        int const x = xa + n * x_step;
+        int const y = ya + y_offset * y_step;
+        int const px = steep ? y : x;
+        int const py = steep ? x : y;
+        if (px >= 0 && px < WIDTH && py >= 0 && py < HEIGHT) {
             // If the line type is '0', this will clear the pixel
             // If it is '1' or '2', the pixel will be set
-            setPixel(x,y, type);
+            if (type) BUFFER_BYTE(px, py/8) |= (1 << py%8);
+            else      BUFFER_BYTE(px, py/8) &= ~(1 << py%8);
         }
-    } else {
-
-        // ensure we loop from smallest to largest or else for-loop won't run as expected
-        unsigned int const start = y_range > 0 ? y0:y1;
-        unsigned int const stop =  y_range > 0 ? y1:y0;
-
-        for (unsigned int y = start; y<= stop ; y+=step) {
-            // do linear interpolation
-            int const dy = static_cast<int>(y)-static_cast<int>(y0);
-            unsigned int const x = x0 + x_range * dy / y_range;
-
-            // If the line type is '0', this will clear the pixel
-            // If it is '1' or '2', the pixel will be set
-            setPixel(x,y, type);
+        error += dy * step;
+        while (dx > 0 && error >= dx) {  // at most twice, as dy <= dx
+            y_offset++;
+            error -= dx;
         }
     }
 
@@ -474,19 +768,177 @@ void N5110::drawRect(unsigned int const x0,
                      unsigned int const height,
                      FillType const     fill)
 {
+    if (width == 0 || height == 0) {
+        return;
+    }
+    // the coordinates can be negative (e.g. x-1 from a caller), as with drawLine
+    int const left = static_cast<int>(x0);
+    int const top = static_cast<int>(y0);
+    int const right = left + static_cast<int>(width) - 1;
+    int const bottom = top + static_cast<int>(height) - 1;
+
     if (fill == FILL_TRANSPARENT) { // transparent, just outline
-        drawLine(x0,y0,x0+(width-1),y0,1);  // top
-        drawLine(x0,y0+(height-1),x0+(width-1),y0+(height-1),1);  // bottom
-        drawLine(x0,y0,x0,y0+(height-1),1);  // left
-        drawLine(x0+(width-1),y0,x0+(width-1),y0+(height-1),1);  // right
+        hSpan(left,right,top,true);  // top
+        hSpan(left,right,bottom,true);  // bottom
+        vSpan(left,top,bottom,true);  // left
+        vSpan(right,top,bottom,true);  // right
     } else { // filled rectangle
-        int type = (fill==FILL_BLACK) ? 1:0;  // black or white fill
-        for (int y = y0; y<y0+height; y++) {  // loop through rows of rectangle
-            drawLine(x0,y,x0+(width-1),y,type);  // draw line across screen
+        fillRect(left,top,width,height,fill==FILL_BLACK);  // black or white fill
+    }
+}
+
+void N5110::fillRect(int const  x0,
+                     int const  y0,
+                     int const  width,
+                     int const  height,
+                     bool const state)
+{
+    rasterRect(x0,y0,width,height,state ? 0xFF : 0x00,OP_COPY);
+}
+
+void N5110::invertRect(int const x0,
+                       int const y0,
+                       int const width,
+                       int const height)
+{
+    rasterRect(x0,y0,width,height,0xFF,OP_XOR);
+}
+
+// combining source bits with a buffer byte through any raster operation can be
+// written as byte = (byte & keep) ^ flip, only the bits set in mask are changed
+static inline void rasterMasks(unsigned char const bits,
+                               unsigned char const mask,
+                               RasterOp const      op,
+                               unsigned char      &keep,
+                               unsigned char      &flip)
+{
+    switch (op) {
+        case OP_COPY:
+            keep = ~mask;
+            flip = bits & mask;
+            break;
+        case OP_OR:
+            keep = ~(bits & mask);
+            flip = bits & mask;
+            break;
+        case OP_AND:
+            keep = bits | ~mask;
+            flip = 0x00;
+            break;
+        default:  // OP_XOR
+            keep = 0xFF;
+            flip = bits & mask;
+            break;
+    }
+}
+
+void N5110::rasterRect(int const           x0,
+                       int const           y0,
+                       int const           width,
+                       int const           height,
+                       unsigned char const bits,
+                       RasterOp const      op)
+{
+    // clip to the screen, x1 and y1 are one past the last column and row
+    int const x_start = x0 > 0 ? x0 : 0;
+    int const y_start = y0 > 0 ? y0 : 0;
+    int const x1 = x0 + width < WIDTH ? x0 + width : WIDTH;
+    int const y1 = y0 + height < HEIGHT ? y0 + height : HEIGHT;
+    if (x_start >= x1 || y_start >= y1) {
+        return;
+    }
+
+    int const first_bank = y_start / 8;
+    int const last_bank = (y1 - 1) / 8;
+    for (int bank = first_bank; bank <= last_bank; bank++) {
+        // bits of the bank inside the rectangle, only the top and bottom banks are partial
+        unsigned char mask = 0xFF;
+        if (bank == first_bank) {
+            mask &= 0xFF << (y_start % 8);
+        }
+        if (bank == last_bank) {
+            mask &= 0xFF >> (7 - (y1 - 1) % 8);
+        }
+
+        unsigned char keep;
+        unsigned char flip;
+        rasterMasks(bits, mask, op, keep, flip);
+        for (int x = x_start; x < x1; x++) {
+            BUFFER_BYTE(x, bank) = (BUFFER_BYTE(x, bank) & keep) ^ flip;
+        }
+    }
+}
+
+void N5110::blit(unsigned char const *bitmap,
+                 int const            width,
+                 int const            height,
+                 int const            x0,
+                 int const            y0,
+                 RasterOp const       op,
+                 unsigned char const *mask)
+{
+    int const x_start = x0 > 0 ? x0 : 0;
+    int const x1 = x0 + width < WIDTH ? x0 + width : WIDTH;
+    if (x_start >= x1 || height <= 0) {
+        return;
+    }
+
+    // each source bank lands across two buffer banks, shifted down by the
+    // y offset (rounded towards minus infinity, as y0 can be negative)
+    int const shift = ((y0 % 8) + 8) % 8;
+    int const top_bank = (y0 - shift) / 8;
+    int const banks = (height + 7) / 8;
+
+    for (int b = 0; b < banks; b++) {
+        // rows of the source bank inside the bitmap, the last one can be partial
+        unsigned char const rows = (b == banks - 1) ? 0xFF >> (banks * 8 - height) : 0xFF;
+        int const offset = b * width + (x_start - x0);
+        unsigned char const *source = bitmap + offset;
+        unsigned char const *source_mask = mask ? mask + offset : NULL;
+        int const upper = top_bank + b;  // buffer banks holding the top and bottom parts
+        int const lower = upper + 1;
+
+        if (upper >= 0 && upper < BANKS) {
+            for (int x = x_start; x < x1; x++) {
+                unsigned char const pixels = source_mask ? rows & source_mask[x - x_start] : rows;
+                unsigned char keep;
+                unsigned char flip;
+                rasterMasks(source[x - x_start] << shift, pixels << shift, op, keep, flip);
+                BUFFER_BYTE(x, upper) = (BUFFER_BYTE(x, upper) & keep) ^ flip;
+            }
+        }
+        if (shift != 0 && lower >= 0 && lower < BANKS) {
+            for (int x = x_start; x < x1; x++) {
+                unsigned char const pixels = source_mask ? rows & source_mask[x - x_start] : rows;
+                unsigned char keep;
+                unsigned char flip;
+                rasterMasks(source[x - x_start] >> (8 - shift), pixels >> (8 - shift), op, keep, flip);
+                BUFFER_BYTE(x, lower) = (BUFFER_BYTE(x, lower) & keep) ^ flip;
+            }
         }
     }
 }
 
+void N5110::hSpan(int const  x0,
+                  int const  x1,
+                  int const  y,
+                  bool const state)
+{
+    int const left = x0 < x1 ? x0 : x1;
+    int const right = x0 < x1 ? x1 : x0;
+    fillRect(left, y, right - left + 1, 1, state);
+}
+
+void N5110::vSpan(int const  x,
+                  int const  y0,
+                  int const  y1,
+                  bool const state)
+{
+    int const top = y0 < y1 ? y0 : y1;
+    int const bottom = y0 < y1 ? y1 : y0;
+    fillRect(x, top, 1, bottom - top + 1, state);
+}
+
 void N5110::drawSprite(const char *sprite)
 {
     for (int x = 0; x < 84; x++) {
@@ -495,8 +947,43 @@ void N5110::drawSprite(const char *sprite)
         
             //int pixel = *((sprite+i*ncols)+j);
             //setPixel(x0+j,y0+i, pixel);
-            buffer[x][5-y] = sprite[(x*6)+y];
+            BUFFER_BYTE(x, 5-y) = sprite[(x*6)+y];
+        }
+    }
+}
+
+void N5110::drawSprite(Sprite const  &sprite,
+                       int const      x0,
+                       int const      y0,
+                       RasterOp const op)
+{
+    if (sprite.encoding == SPRITE_RAW) {
+        blit(sprite.data, sprite.width, sprite.height, x0, y0, op);
+        return;
+    }
+
+    // RLE sprites are decoded one bank row at a time, and each row is blitted
+    // like a bitmap 8 pixels high (or less for the last one). A run can carry
+    // on into the next row, so the decoder state is kept across rows
+    unsigned char row[256];
+    unsigned char const *packet = sprite.data;
+    int run = 0;         // bytes left in the current packet
+    bool repeat = false; // the packet repeats one byte rather than listing them
+
+    for (int top = 0; top < sprite.height; top += 8) {
+        for (int x = 0; x < sprite.width; x++) {
+            if (run == 0) {
+                unsigned char const header = *packet++;
+                repeat = header >= 0x80;
+                run = repeat ? (header - 0x80) + 3 : header + 1;
+            }
+            row[x] = repeat ? *packet : *packet++;
+            if (--run == 0 && repeat) {
+                packet++;  // past the repeated byte
+            }
         }
+        int const rows = sprite.height - top < 8 ? sprite.height - top : 8;
+        blit(row, sprite.width, rows, x0, y0 + top, op);
     }
 }
 
@@ -8,6 +8,15 @@
 #define HEIGHT 48
 #define BANKS 6
 
+// uncomment to store the screen buffer bank by bank, in the order it is sent to
+// the display, so that refresh can copy it without transposing it
+//#define N5110_BANK_MAJOR
+
+// frames between key frames when mirroring to a serial port (see N5110::mirrorTo)
+#define N5110_MIRROR_KEY_INTERVAL 50
+// bytes of a mirror packet gathered before each write to the port
+#define N5110_MIRROR_CHUNK 32
+
 /// Fill types for 2D shapes
 enum FillType {
     FILL_TRANSPARENT, ///< Transparent with outline
@@ -15,6 +24,28 @@ enum FillType {
     FILL_WHITE,       ///< Filled white (no outline)
 };
 
+/// Raster operations combining a source with the screen buffer
+enum RasterOp {
+    OP_COPY,  ///< Replace the pixels with the source
+    OP_OR,    ///< Set the pixels set in the source
+    OP_AND,   ///< Clear the pixels clear in the source
+    OP_XOR,   ///< Invert the pixels set in the source
+};
+
+/// Storage formats for sprite data
+enum SpriteEncoding {
+    SPRITE_RAW,  ///< Bank rows of column bytes, as taken by N5110::blit
+    SPRITE_RLE,  ///< The same bytes run-length encoded (see N5110::drawSprite)
+};
+
+/// A sprite of any size held in flash, pre-oriented to match the screen buffer
+struct Sprite {
+    unsigned char width;          ///< Width in pixels
+    unsigned char height;         ///< Height in pixels
+    SpriteEncoding encoding;      ///< How data is stored
+    const unsigned char *data;    ///< Pixel data, (height+7)/8 banks of width bytes once decoded
+};
+
 /** N5110 Class
 @brief Library for interfacing with Nokia 5110 LCD display (https://www.sparkfun.com/products/10168) using the hardware SPI on the mbed.
 @brief The display is powered from a GPIO pin meaning it can be controlled via software.  The LED backlight is also software-controllable (via PWM pin).
@@ -187,7 +218,19 @@ private:
     DigitalOut  *_dc;
 
 // variables
+#ifdef N5110_BANK_MAJOR
+    unsigned char buffer[6][84];  // screen buffer - stored bank by bank - each byte is 8 vertical pixels
+#else
     unsigned char buffer[84][6];  // screen buffer - the 6 is for the banks - each one is 8 bits;
+#endif
+    unsigned char front_buffer[6][84];  // the display RAM as of the last refresh, in the order it is sent
+    volatile bool _flushing;  // a refresh is sending front_buffer
+    bool _frame_open;  // the sent frame still has to be ended by endRefresh
+    FileHandle  *_mirror;  // port each refreshed frame is mirrored to, NULL when off
+    unsigned int _mirror_frames;  // frames mirrored since mirrorTo
+    unsigned char _mirror_chunk[N5110_MIRROR_CHUNK];  // packet bytes not yet written
+    int _mirror_chunk_len;
+    bool _mirror_short;  // a write of the current packet fell short
 
 public:
     /** Create a N5110 object connected to the specified pins
@@ -280,13 +323,22 @@ public:
 
     /** Print String
     *
-    *   Prints a string of characters to the screen buffer. String is cut-off after the 83rd pixel.
-    *   @param x - the column number (0 to 83)
-    *   @param y - the row number (0 to 5) - the display is split into 6 banks - each bank can be considered a row
+    *   Prints a string of characters to the screen buffer at any pixel position. The text is ORed
+    *   into the buffer and clipped to the screen, characters outside the font are printed as spaces.
+    *   @param x - the column of the left of the text (can be negative)
+    *   @param y - the pixel row of the top of the text (can be negative)
+    */
+    void printString(char const *str,
+                     int const   x,
+                     int const   y);
+
+    /** String Width
+    *
+    *   Returns the number of columns printString advances over a string (6 per character,
+    *   including the gap after the last one).
+    *   @param str - the string to measure
     */
-    void printString(char const         *str,
-                     unsigned int const  x,
-                     unsigned int const  y);
+    int stringWidth(char const *str) const;
 
     /** Print Character
     *
@@ -342,9 +394,40 @@ public:
     /** Refresh display
     *
     *   This functions sends the screen buffer to the display.
+    *   Only the columns of each bank that changed since the last refresh are sent,
+    *   unless addressing the changed ranges would cost more than sending the whole buffer.
+    *   With DEVICE_SPI_ASYNCH the transfer is started and the function returns, so the
+    *   next frame can be drawn into the buffer while the previous one is sent.
     */
     void refresh();
 
+    /** Wait for refresh
+    *
+    *   Waits until the transfer started by the last refresh has completed and ends
+    *   its frame (returns straight away without DEVICE_SPI_ASYNCH). The display's
+    *   chip select stays low from the end of the transfer until this is called,
+    *   at the latest by the next refresh or command.
+    */
+    void waitForFlush();
+
+    /** Mirror frames to a serial port
+    *
+    *   Sends every refreshed frame over a serial port for diagnostics, so the screen can be
+    *   watched on a PC (see host/FrameViewer.cpp). Each frame is sent as a packet:
+    *   0xA5 0x5A, 'K' or 'D', the payload length (2 bytes, low byte first), the payload, and a
+    *   Fletcher-16 checksum of the new frame (2 bytes, low byte first). The payload is the
+    *   504 bytes of the frame in display order (bank by bank), run-length encoded as for
+    *   drawSprite. Key frames ('K') hold the frame itself, and are sent first and then every
+    *   N5110_MIRROR_KEY_INTERVAL frames; delta frames ('D') hold the frame XORed with the
+    *   previous one, which is mostly zeros and packs into a few bytes. The packet is written
+    *   N5110_MIRROR_CHUNK bytes at a time. A UARTSerial queues them in its transmit buffer and
+    *   sends them from interrupts, so refresh only waits when a packet doesn't fit in the free
+    *   space (blocking mode). If a write falls short (non-blocking mode, or an error) the rest
+    *   of the packet is dropped, the viewer rejects it on its checksum, and a key frame is sent next.
+    *   @param port - the port to send frames to (e.g. a UARTSerial at 115200 baud), or NULL to stop
+    */
+    void mirrorTo(FileHandle *port);
+
     /** Randomise buffer
     *
     *   This function fills the buffer with random data.  Can be used to test the display.
@@ -364,7 +447,7 @@ public:
     /** Draw Circle
     *
     *   This function draws a circle at the specified origin with specified radius in the screen buffer
-    *   Uses the midpoint circle algorithm.
+    *   Uses the midpoint circle algorithm, filled circles are drawn as horizontal spans.
     *   @see http://en.wikipedia.org/wiki/Midpoint_circle_algorithm
     *   @param  x0     - x-coordinate of centre
     *   @param  y0     - y-coordinate of centre
@@ -378,7 +461,8 @@ public:
 
     /** Draw Line
     *
-    *   This function draws a line between the specified points using linear interpolation.
+    *   This function draws a line between the specified points using Bresenham's line algorithm.
+    *   @see http://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
     *   @param  x0 - x-coordinate of first point
     *   @param  y0 - y-coordinate of first point
     *   @param  x1 - x-coordinate of last point
@@ -391,6 +475,83 @@ public:
                   unsigned int const y1,
                   unsigned int const type);
 
+    /** Fill Rectangle
+    *
+    *   This function sets or clears every pixel of a rectangle, writing whole bank bytes
+    *   through masks for the top and bottom banks. The rectangle is clipped to the screen,
+    *   so the origin can be negative.
+    *   @param  x0 - x-coordinate of origin (top-left)
+    *   @param  y0 - y-coordinate of origin (top-left)
+    *   @param  width - width of rectangle
+    *   @param  height - height of rectangle
+    *   @param  state - true to set the pixels (black), false to clear them (white)
+    */
+    void fillRect(int const  x0,
+                  int const  y0,
+                  int const  width,
+                  int const  height,
+                  bool const state);
+
+    /** Invert Rectangle
+    *
+    *   This function inverts every pixel of a rectangle (clipped to the screen), a bank byte at a time.
+    *   @param  x0 - x-coordinate of origin (top-left)
+    *   @param  y0 - y-coordinate of origin (top-left)
+    *   @param  width - width of rectangle
+    *   @param  height - height of rectangle
+    */
+    void invertRect(int const x0,
+                    int const y0,
+                    int const width,
+                    int const height);
+
+    /** Blit
+    *
+    *   This function combines a 1-bit bitmap with the screen buffer at any position, clipped to the screen.
+    *   The bitmap is stored like the display: height/8 (rounded up) banks of width bytes, one byte
+    *   per column with the top pixel in bit 0. Each byte is shifted into place and written with masks.
+    *   @param  bitmap - the bitmap data
+    *   @param  width - width of bitmap in pixels
+    *   @param  height - height of bitmap in pixels
+    *   @param  x0 - x-coordinate of origin (top-left)
+    *   @param  y0 - y-coordinate of origin (top-left)
+    *   @param  op - how the bitmap is combined with the buffer
+    *   @param  mask - optional transparency mask in the same layout, only pixels set in it are changed
+    */
+    void blit(unsigned char const *bitmap,
+              int const            width,
+              int const            height,
+              int const            x0,
+              int const            y0,
+              RasterOp const       op,
+              unsigned char const *mask = NULL);
+
+    /** Horizontal Span
+    *
+    *   This function sets or clears a horizontal line of pixels (clipped to the screen).
+    *   @param  x0 - x-coordinate of first pixel
+    *   @param  x1 - x-coordinate of last pixel
+    *   @param  y - y-coordinate of the line
+    *   @param  state - true to set the pixels (black), false to clear them (white)
+    */
+    void hSpan(int const  x0,
+               int const  x1,
+               int const  y,
+               bool const state);
+
+    /** Vertical Span
+    *
+    *   This function sets or clears a vertical line of pixels (clipped to the screen).
+    *   @param  x - x-coordinate of the line
+    *   @param  y0 - y-coordinate of first pixel
+    *   @param  y1 - y-coordinate of last pixel
+    *   @param  state - true to set the pixels (black), false to clear them (white)
+    */
+    void vSpan(int const  x,
+               int const  y0,
+               int const  y1,
+               bool const state);
+
     /** Draw Rectangle
     *
     *   This function draws a rectangle.
@@ -417,6 +578,22 @@ public:
     */
     void drawSprite(const char *sprite);
 
+    /** Draw Sprite
+    *
+    *   This function draws a sprite at any position, clipped to the screen. RLE sprites are
+    *   decoded a bank at a time straight into the buffer. The RLE stream is a series of
+    *   packets: a header byte h < 128 is followed by h+1 literal bytes, and a header byte
+    *   h >= 128 is followed by one byte that is repeated (h-128)+3 times.
+    *   @param  sprite - the sprite to draw
+    *   @param  x0 - x-coordinate of origin (top-left)
+    *   @param  y0 - y-coordinate of origin (top-left)
+    *   @param  op - how the sprite is combined with the buffer (copied by default)
+    */
+    void drawSprite(Sprite const  &sprite,
+                    int const      x0,
+                    int const      y0,
+                    RasterOp const op = OP_COPY);
+
 
 private:
 // methods
@@ -428,6 +605,27 @@ private:
     void clearRAM();
     void sendCommand(unsigned char command);
     void sendData(unsigned char data);
+    void sendAddress(unsigned int const x,
+                     unsigned int const bank);
+    void endRefresh();
+    void copyToFront(int const start,
+                     int const length);
+    unsigned char mirrorByte(int const  n,
+                             bool const key) const;
+    int encodeMirror(bool const key,
+                     bool const send);
+    void sendMirror();
+    void putMirror(unsigned char const byte);
+    void flushMirror();
+    void rasterRect(int const           x0,
+                    int const           y0,
+                    int const           width,
+                    int const           height,
+                    unsigned char const bits,
+                    RasterOp const      op);
+#if DEVICE_SPI_ASYNCH
+    void flushComplete(int event);
+#endif
     void setTempCoefficient(char tc);  // 0 to 3
     void setBias(char bias);  // 0 to 7
 };
@@ -2,205 +2,88 @@
 #define DATA_H
 
 #include "Utils.h"
+#include "N5110.h"
 
-const Vector3 verts[8] = {{-1.0, -1.0, -1.0}, {-1.0, -1.0, 1.0}, {-1.0, 1.0, -1.0}, {-1.0, 1.0, 1.0}, {1.0, -1.0, -1.0}, {1.0, -1.0, 1.0}, {1.0, 1.0, -1.0}, {1.0, 1.0, 1.0}};
+const Vertex verts[8] = {{-1.0, -1.0, -1.0}, {-1.0, -1.0, 1.0}, {-1.0, 1.0, -1.0}, {-1.0, 1.0, 1.0}, {1.0, -1.0, -1.0}, {1.0, -1.0, 1.0}, {1.0, 1.0, -1.0}, {1.0, 1.0, 1.0}};
 const unsigned short faces[6][4] = {{0, 1, 3, 2}, {2, 3, 7, 6}, {6, 7, 5, 4}, {4, 5, 1, 0}, {2, 6, 4, 0}, {7, 3, 1, 5}};
 
-ObjData cube_object2 = {verts, faces[0], 6};
+ObjData cube_object2 = {verts, 8, faces[0], 6, 1.733};
 
-const Vector3 verts2[570] = {{0.7205821871757507, 1.6633211374282837, 0.08048629760742188}, {0.784212589263916, 1.6193623542785645, 0.1443706899881363}, {0.8468549847602844, 1.5769133567810059, 0.07744631916284561}, {0.8458486199378967, 1.5784510374069214, -0.05581739544868469}, {0.782218337059021, 1.622409701347351, -0.1197018027305603}, {0.719575822353363, 1.6648590564727783, -0.05277741700410843}, {0.8200704455375671, 1.7909302711486816, 0.08053633570671082}, {0.8695177435874939, 1.7288626432418823, 0.14441464841365814}, {0.9179772138595581, 1.6683045625686646, 0.07748415321111679}, {0.9169707894325256, 1.66984224319458, -0.05577954649925232}, {0.8675234913825989, 1.7319098711013794, -0.11965787410736084}, {0.8190640807151794, 1.7924679517745972, -0.05272737890481949}, {0.974463939666748, 1.855852484703064, 0.07895071059465408}, {0.9876154661178589, 1.7805958986282349, 0.14322766661643982}, {0.999779462814331, 1.7068485021591187, 0.07669586688280106}, {0.9987729787826538, 1.7083863019943237, -0.05656786262989044}, {0.9856213331222534, 1.783643126487732, -0.12084482610225677}, {0.9734574556350708, 1.857390284538269, -0.05431300401687622}, {1.1641303300857544, 1.8265695571899414, 0.07564036548137665}, {1.1225594282150269, 1.7603250741958618, 0.14087945222854614}, {1.080000877380371, 1.6955896615982056, 0.07530978322029114}, {1.0789945125579834, 1.6971274614334106, -0.057953931391239166}, {1.1205650568008423, 1.7633724212646484, -0.12319302558898926}, {1.1631239652633667, 1.828107237815857, -0.057623349130153656}, {1.2866343259811401, 1.607007622718811, 0.07099508494138718}, {1.2137255668640137, 1.5939933061599731, 0.1373858004808426}, {1.139829397201538, 1.5824882984161377, 0.07296775281429291}, {1.1388230323791504, 1.5840259790420532, -0.0602959468960762}, {1.2117314338684082, 1.5970405340194702, -0.1266866773366928}, {1.2856277227401733, 1.6085453033447266, -0.06226862221956253}, {1.2567381858825684, 1.313240647315979, 0.0677884966135025}, {1.186639666557312, 1.3388291597366333, 0.13461795449256897}, {1.115553379058838, 1.365926742553711, 0.07063861936330795}, {1.1145468950271606, 1.367464542388916, -0.06262508779764175}, {1.184645414352417, 1.3418762683868408, -0.12945452332496643}, {1.2557319402694702, 1.314778447151184, -0.0654752105474472}, {1.1092994213104248, 1.0182573795318604, 0.0663914680480957}, {1.050674557685852, 1.06702721118927, 0.13333244621753693}, {0.9910614490509033, 1.1173063516616821, 0.06946467608213425}, {0.9900552034378052, 1.1188443899154663, -0.06379903107881546}, {1.048680305480957, 1.070074439048767, -0.13074001669883728}, {1.108293056488037, 1.0197951793670654, -0.0668722540140152}, {0.8659949898719788, 0.7867064476013184, 0.0672752857208252}, {0.8290981650352478, 0.8555859327316284, 0.13413026928901672}, {0.7912135124206543, 0.9259747266769409, 0.07017643004655838}, {0.7902070879936218, 0.9275126457214355, -0.06308729201555252}, {0.8271039128303528, 0.8586331009864807, -0.12994223833084106}, {0.8649885654449463, 0.7882442474365234, -0.06598841398954391}, {0.6895265579223633, 0.6331203579902649, 0.06821846961975098}, {0.6526296138763428, 0.7019999027252197, 0.13507340848445892}, {0.614745020866394, 0.772388756275177, 0.07111960649490356}, {0.6137385368347168, 0.7739266157150269, -0.06214410066604614}, {0.650635302066803, 0.7050470113754272, -0.12899906933307648}, {0.688520073890686, 0.63465815782547, -0.06504524499177933}, {0.4841252863407135, 0.5197523236274719, 0.06821846961975098}, {0.44722840189933777, 0.5886318683624268, 0.13507340848445892}, {0.40934380888938904, 0.659020721912384, 0.07111960649490356}, {0.4083373248577118, 0.6605585813522339, -0.06214410066604614}, {0.4452340602874756, 0.5916789770126343, -0.12899906933307648}, {0.48311880230903625, 0.521290123462677, -0.06504524499177933}, {0.8499264121055603, 1.4175302982330322, 1.0769889513539965e-07}, {0.785229504108429, 1.4175302982330322, 0.32525306940078735}, {0.6009885668754578, 1.4175302982330322, 0.6009891033172607}, {0.3252524435520172, 1.4175302982330322, 0.7852300405502319}, {-0.3252532482147217, 1.4175302982330322, 0.7852301001548767}, {-0.6009894609451294, 1.4175302982330322, 0.6009891033172607}, {-0.7852304577827454, 1.4175302982330322, 0.32525286078453064}, {-0.8499273061752319, 1.4175302982330322, -2.435454007354565e-07}, {-0.785230278968811, 1.4175302982330322, -0.3252532482147217}, {-0.6009891033172607, 1.4175302982330322, -0.6009893417358398}, {-0.3252526819705963, 1.4175302982330322, -0.7852302193641663}, {0.3252533972263336, 1.4175302982330322, -0.7852295637130737}, {0.6009894013404846, 1.4175302982330322, -0.6009882092475891}, {0.7852300405502319, 1.4175302982330322, -0.32525163888931274}, {0.4544179141521454, 0.3115013837814331, -1.4665377534583968e-07}, {0.5959743857383728, 0.47137248516082764, 1.2302199081659637e-07}, {0.778468132019043, 1.3382757902145386, 9.581835058725119e-08}, {0.6776367425918579, 0.8833848237991333, -0.28068533539772034}, {0.719210684299469, 1.3382757902145386, 0.29790714383125305}, {0.5506084561347961, 0.47137248516082764, 0.22806976735591888}, {0.419827401638031, 0.3115013539791107, 0.1738981306552887}, {0.5186409950256348, 0.8833848237991333, -0.5186400413513184}, {0.5504599213600159, 1.3382757902145386, 0.5504604578018188}, {0.4214174151420593, 0.47137251496315, 0.42141783237457275}, {0.32132190465927124, 0.3115013539791107, 0.321321964263916}, {0.28068676590919495, 0.8833848237991333, -0.677636444568634}, {0.2979065775871277, 1.3382757902145386, 0.719211220741272}, {0.22806930541992188, 0.47137251496315, 0.5506089329719543}, {0.17389808595180511, 0.3115013837814331, 0.419827401638031}, {-0.28068605065345764, 0.8833848237991333, -0.677636981010437}, {-0.29790738224983215, 1.3382757902145386, 0.7192112803459167}, {-0.22806985676288605, 0.47137251496315, 0.5506089329719543}, {-0.17389841377735138, 0.3115013837814331, 0.4198274612426758}, {-0.5186406970024109, 0.8833848237991333, -0.5186411142349243}, {-0.5504608750343323, 1.3382757902145386, 0.5504604578018188}, {-0.4214180111885071, 0.47137251496315, 0.421417772769928}, {-0.3213222920894623, 0.3115013539791107, 0.321321964263916}, {-0.6776368618011475, 0.8833848237991333, -0.28068670630455017}, {-0.7192116379737854, 1.3382757902145386, 0.2979069650173187}, {-0.5506091117858887, 0.47137248516082764, 0.22806960344314575}, {-0.41982778906822205, 0.3115013539791107, 0.17389802634716034}, {-0.7334690093994141, 0.8833848237991333, -3.094309590778721e-07}, {-0.7784690856933594, 1.3382757902145386, -2.258946665278927e-07}, {-0.5959749221801758, 0.47137248516082764, -1.2327296872172155e-07}, {-0.45441827178001404, 0.3115013539791107, -3.3444845826124947e-07}, {-0.6776371002197266, 0.8833848237991333, 0.2806861400604248}, {-0.7192114591598511, 1.3382757902145386, -0.2979073226451874}, {-0.5506089925765991, 0.47137248516082764, -0.22806982696056366}, {-0.4198276698589325, 0.3115013539791107, -0.17389865219593048}, {-0.5186409950256348, 0.8833848237991333, 0.5186406373977661}, {-0.5504604578018188, 1.3382757902145386, -0.5504606366157532}, {-0.421417772769928, 0.47137245535850525, -0.4214179515838623}, {-0.32132211327552795, 0.3115013539791107, -0.3213224709033966}, {-0.2806865870952606, 0.8833848237991333, 0.6776366233825684}, {-0.2979068458080292, 1.3382757902145386, -0.7192113995552063}, {-0.22806942462921143, 0.47137245535850525, -0.5506088137626648}, {-0.1738981157541275, 0.31150132417678833, -0.4198278486728668}, {0.2806859314441681, 0.8833848237991333, 0.6776366233825684}, {0.29790744185447693, 1.3382757902145386, -0.7192107439041138}, {0.22807000577449799, 0.47137245535850525, -0.5506083965301514}, {0.17389856278896332, 0.31150132417678833, -0.41982749104499817}, {0.5186402797698975, 0.8833848237991333, 0.5186406373977661}, {0.5504606366157532, 1.3382757902145386, -0.5504595637321472}, {0.4214180111885071, 0.47137245535850525, -0.4214170575141907}, {0.32132232189178467, 0.3115013539791107, -0.32132184505462646}, {0.6776363253593445, 0.8833848237991333, 0.28068631887435913}, {0.7192111611366272, 1.3382757902145386, -0.2979058623313904}, {0.5506088733673096, 0.47137248516082764, -0.22806869447231293}, {0.4198276400566101, 0.3115013539791107, -0.17389781773090363}, {0.7334682941436768, 0.8833848237991333, -6.314657241546229e-09}, {0.22678835690021515, -0.326608806848526, -1.1369904768798733e-06}, {0.25077199935913086, 0.2286219447851181, -9.208534379467892e-07}, {0.2316831350326538, 0.22862188518047333, 0.09596532583236694}, {0.20952512323856354, -0.3266088664531708, 0.08678694814443588}, {0.1773226112127304, 0.22862190008163452, 0.17732155323028564}, {0.16036362946033478, -0.3266088664531708, 0.16036230325698853}, {0.09596636891365051, 0.22862190008163452, 0.23168207705020905}, {0.08678823709487915, -0.3266088664531708, 0.20952382683753967}, {-0.09596607089042664, 0.22862190008163452, 0.23168204724788666}, {-0.0867878869175911, -0.3266088664531708, 0.20952379703521729}, {-0.1773223727941513, 0.22862190008163452, 0.17732152342796326}, {-0.1603633016347885, -0.3266088664531708, 0.16036230325698853}, {-0.23168286681175232, 0.22862188518047333, 0.09596526622772217}, {-0.20952479541301727, -0.3266088664531708, 0.08678688853979111}, {-0.25077173113822937, 0.22862188518047333, -1.024488483380992e-06}, {-0.22678802907466888, -0.3266088664531708, -1.230714133271249e-06}, {-0.23168280720710754, 0.22862188518047333, -0.09596728533506393}, {-0.2095247507095337, -0.3266088664531708, -0.0867893323302269}, {-0.17732222378253937, 0.22862187027931213, -0.17732354998588562}, {-0.16036319732666016, -0.3266088664531708, -0.16036470234394073}, {-0.0959658995270729, 0.22862187027931213, -0.23168402910232544}, {-0.08678773045539856, -0.3266088664531708, -0.2095261961221695}, {0.0959666520357132, 0.22862187027931213, -0.23168382048606873}, {0.08678849041461945, -0.3266088664531708, -0.20952600240707397}, {0.1773228794336319, 0.22862187027931213, -0.17732317745685577}, {0.1603638380765915, -0.3266088664531708, -0.16036438941955566}, {0.23168326914310455, 0.22862188518047333, -0.09596683830022812}, {0.2095252424478531, -0.3266088664531708, -0.08678892999887466}, {0.7186056971549988, 1.762908697128296, 1.8773370413782686e-08}, {0.6639050245285034, 1.762908697128296, 0.2749987542629242}, {0.5081308484077454, 1.762908697128296, 0.5081313848495483}, {0.27499818801879883, 1.762908697128296, 0.6639055609703064}, {-0.27499905228614807, 1.762908697128296, 0.6639056205749512}, {-0.5081318020820618, 1.762908697128296, 0.5081313252449036}, {-0.6639060974121094, 1.762908697128296, 0.27499857544898987}, {-0.7186066508293152, 1.762908697128296, -2.120128783644759e-07}, {-0.663905918598175, 1.762908697128296, -0.2749989628791809}, {-0.5081314444541931, 1.762908697128296, -0.5081315040588379}, {-0.27499857544898987, 1.762908697128296, -0.663905680179596}, {0.2749989628791809, 1.762908697128296, -0.663905143737793}, {0.5081315040588379, 1.762908697128296, -0.5081306099891663}, {0.6639054417610168, 1.762908697128296, -0.2749975621700287}, {0.5783174633979797, -0.565528154373169, -1.8617564023770683e-07}, {0.5342956185340881, -0.565528154373169, 0.2213125377893448}, {0.5342956185340881, -0.4693976640701294, 0.2213125228881836}, {0.40893200039863586, -0.565528154373169, 0.4089323878288269}, {0.40893200039863586, -0.469397634267807, 0.4089323878288269}, {0.22131215035915375, -0.565528154373169, 0.534295916557312}, {0.22131215035915375, -0.469397634267807, 0.534295916557312}, {-0.22131313383579254, -0.565528154373169, 0.534295916557312}, {-0.22131313383579254, -0.469397634267807, 0.534295916557312}, {-0.4089331030845642, -0.565528154373169, 0.40893232822418213}, {-0.4089331030845642, -0.469397634267807, 0.40893232822418213}, {-0.5342966914176941, -0.565528154373169, 0.22131235897541046}, {-0.5342966914176941, -0.4693976640701294, 0.22131234407424927}, {-0.5783185362815857, -0.565528154373169, -4.251729137649818e-07}, {-0.5783185362815857, -0.4693976640701294, -4.2937492139571987e-07}, {-0.5342965126037598, -0.565528154373169, -0.22131319344043732}, {-0.5342965126037598, -0.4693976640701294, -0.2213132083415985}, {-0.4089328348636627, -0.565528154373169, -0.4089330732822418}, {-0.4089328348636627, -0.4693976938724518, -0.4089330732822418}, {-0.2213127613067627, -0.565528154373169, -0.5342965722084045}, {-0.2213127613067627, -0.4693976938724518, -0.5342965722084045}, {0.22131280601024628, -0.565528154373169, -0.5342960953712463}, {0.22131280601024628, -0.4693976938724518, -0.5342960953712463}, {0.4089325964450836, -0.565528154373169, -0.4089322090148926}, {0.4089325964450836, -0.4693976938724518, -0.4089322090148926}, {0.5342959761619568, -0.565528154373169, -0.22131210565567017}, {0.5342959761619568, -0.4693976640701294, -0.22131212055683136}, {0.5783174633979797, -0.4693976640701294, -1.903776336575902e-07}, {0.8126794099807739, 1.7572910785675049, 0.3366231322288513}, {0.8796379566192627, 1.7572910785675049, 7.658146472522276e-08}, {0.6219978332519531, 1.7572910785675049, 0.6219983100891113}, {0.33662256598472595, 1.7572910785675049, 0.8126799464225769}, {-0.3366234004497528, 1.7572910785675049, 0.8126800060272217}, {-0.6219987869262695, 1.7572910785675049, 0.6219983100891113}, {-0.8126804828643799, 1.7572910785675049, 0.336622953414917}, {-0.8796389102935791, 1.7572910785675049, -2.8694165621345746e-07}, {-0.8126802444458008, 1.7572910785675049, -0.3366234302520752}, {-0.6219983696937561, 1.7572910785675049, -0.6219986081123352}, {-0.33662283420562744, 1.7572910785675049, -0.8126801252365112}, {0.33662351965904236, 1.7572910785675049, -0.8126794695854187}, {0.6219986081123352, 1.7572910785675049, -0.6219974160194397}, {0.8126799464225769, 1.7572910785675049, -0.33662179112434387}, {0.6639050245285034, 1.4943641424179077, 0.2749987840652466}, {0.7186056971549988, 1.4943641424179077, 1.612966116226744e-08}, {0.5081308484077454, 1.4943641424179077, 0.5081313848495483}, {0.27499818801879883, 1.4943641424179077, 0.6639055609703064}, {-0.27499905228614807, 1.4943641424179077, 0.6639056205749512}, {-0.5081318020820618, 1.4943641424179077, 0.5081313252449036}, {-0.6639060974121094, 1.4943641424179077, 0.27499857544898987}, {-0.7186066508293152, 1.4943641424179077, -2.146565805105638e-07}, {-0.663905918598175, 1.4943641424179077, -0.2749989628791809}, {-0.5081314444541931, 1.4943641424179077, -0.5081315040588379}, {-0.27499857544898987, 1.4943641424179077, -0.663905680179596}, {0.2749989628791809, 1.4943641424179077, -0.663905143737793}, {0.5081315040588379, 1.4943641424179077, -0.5081306099891663}, {0.6639054417610168, 1.4943641424179077, -0.2749975621700287}, {0.7991217970848083, 1.7976492643356323, 4.4671239152194175e-08}, {0.7382922768592834, 1.7976492643356323, 0.30581095814704895}, {0.5650643110275269, 1.7976492643356323, 0.5650648474693298}, {0.3058103621006012, 1.7976492643356323, 0.7382928133010864}, {-0.3058112561702728, 1.7976492643356323, 0.7382928133010864}, {-0.5650652647018433, 1.7976492643356323, 0.5650647878646851}, {-0.7382933497428894, 1.7976492643356323, 0.30581074953079224}, {-0.7991227507591248, 1.7976492643356323, -2.5248345991712995e-07}, {-0.7382930517196655, 1.7976492643356323, -0.30581119656562805}, {-0.5650649070739746, 1.7976492643356323, -0.5650650858879089}, {-0.30581071972846985, 1.7976492643356323, -0.738292932510376}, {0.3058112561702728, 1.7976492643356323, -0.7382923364639282}, {0.5650650262832642, 1.7976492643356323, -0.5650640726089478}, {0.7382926940917969, 1.7976492643356323, -0.3058096766471863}, {0.2992255687713623, -0.10140156000852585, -7.516040909649746e-07}, {0.27644839882850647, -0.10140161961317062, 0.11450789123773575}, {0.2115844488143921, -0.10140161961317062, 0.21158359944820404}, {0.114508718252182, -0.10140161216259003, 0.2764475345611572}, {-0.11450850963592529, -0.10140161216259003, 0.27644750475883484}, {-0.21158428490161896, -0.10140161961317062, 0.21158356964588165}, {-0.27644819021224976, -0.10140161961317062, 0.11450780928134918}, {-0.299225389957428, -0.10140162706375122, -8.752636517783685e-07}, {-0.276448130607605, -0.10140163451433182, -0.11450953781604767}, {-0.21158412098884583, -0.10140163451433182, -0.21158528327941895}, {-0.11450829356908798, -0.10140164196491241, -0.27644917368888855}, {0.11450905352830887, -0.10140164196491241, -0.27644893527030945}, {0.21158474683761597, -0.10140163451433182, -0.21158483624458313}, {0.2764485478401184, -0.10140163451433182, -0.11450900137424469}, {0.484096884727478, -0.4141780138015747, 0.20051926374435425}, {-0.3705119490623474, -0.4141779839992523, 0.3705114424228668}, {-0.4840971827507019, -0.4141780138015747, 0.2005191147327423}, {-0.48409703373908997, -0.4141780138015747, -0.2005201131105423}, {0.3705122172832489, -0.4141780436038971, -0.37051162123680115}, {-0.20051926374435425, -0.4141780436038971, -0.48409754037857056}, {0.2005194127559662, -0.4141779839992523, 0.4840966761112213}, {-0.5239830017089844, -0.4141780138015747, -5.190973979551927e-07}, {0.5239827632904053, -0.4141780138015747, -3.025546391199896e-07}, {0.20051999390125275, -0.4141780436038971, -0.48409706354141235}, {-0.2005195915699005, -0.4141779839992523, 0.4840966761112213}, {-0.3705116808414459, -0.4141780436038971, -0.370512455701828}, {0.3705116808414459, -0.4141779839992523, 0.37051156163215637}, {0.4840972423553467, -0.4141780138015747, -0.20051917433738708}, {-0.7205821871757507, 1.6633211374282837, 0.08048629760742188}, {-0.784212589263916, 1.6193623542785645, 0.1443706899881363}, {-0.8468549847602844, 1.5769133567810059, 0.07744631916284561}, {-0.8458486199378967, 1.5784510374069214, -0.05581739544868469}, {-0.782218337059021, 1.622409701347351, -0.1197018027305603}, {-0.719575822353363, 1.6648590564727783, -0.05277741700410843}, {-0.8200704455375671, 1.7909302711486816, 0.08053633570671082}, {-0.8695177435874939, 1.7288626432418823, 0.14441464841365814}, {-0.9179772138595581, 1.6683045625686646, 0.07748415321111679}, {-0.9169707894325256, 1.66984224319458, -0.05577954649925232}, {-0.8675234913825989, 1.7319098711013794, -0.11965787410736084}, {-0.8190640807151794, 1.7924679517745972, -0.05272737890481949}, {-0.974463939666748, 1.855852484703064, 0.07895071059465408}, {-0.9876154661178589, 1.7805958986282349, 0.14322766661643982}, {-0.999779462814331, 1.7068485021591187, 0.07669586688280106}, {-0.9987729787826538, 1.7083863019943237, -0.05656786262989044}, {-0.9856213331222534, 1.783643126487732, -0.12084482610225677}, {-0.9734574556350708, 1.857390284538269, -0.05431300401687622}, {-1.1641303300857544, 1.8265695571899414, 0.07564036548137665}, {-1.1225594282150269, 1.7603250741958618, 0.14087945222854614}, {-1.080000877380371, 1.6955896615982056, 0.07530978322029114}, {-1.0789945125579834, 1.6971274614334106, -0.057953931391239166}, {-1.1205650568008423, 1.7633724212646484, -0.12319302558898926}, {-1.1631239652633667, 1.828107237815857, -0.057623349130153656}, {-1.2866343259811401, 1.607007622718811, 0.07099508494138718}, {-1.2137255668640137, 1.5939933061599731, 0.1373858004808426}, {-1.139829397201538, 1.5824882984161377, 0.07296775281429291}, {-1.1388230323791504, 1.5840259790420532, -0.0602959468960762}, {-1.2117314338684082, 1.5970405340194702, -0.1266866773366928}, {-1.2856277227401733, 1.6085453033447266, -0.06226862221956253}, {-1.2567381858825684, 1.313240647315979, 0.0677884966135025}, {-1.186639666557312, 1.3388291597366333, 0.13461795449256897}, {-1.115553379058838, 1.365926742553711, 0.07063861936330795}, {-1.1145468950271606, 1.367464542388916, -0.06262508779764175}, {-1.184645414352417, 1.3418762683868408, -0.12945452332496643}, {-1.2557319402694702, 1.314778447151184, -0.0654752105474472}, {-1.1092994213104248, 1.0182573795318604, 0.0663914680480957}, {-1.050674557685852, 1.06702721118927, 0.13333244621753693}, {-0.9910614490509033, 1.1173063516616821, 0.06946467608213425}, {-0.9900552034378052, 1.1188443899154663, -0.06379903107881546}, {-1.048680305480957, 1.070074439048767, -0.13074001669883728}, {-1.108293056488037, 1.0197951793670654, -0.0668722540140152}, {-0.8659949898719788, 0.7867064476013184, 0.0672752857208252}, {-0.8290981650352478, 0.8555859327316284, 0.13413026928901672}, {-0.7912135124206543, 0.9259747266769409, 0.07017643004655838}, {-0.7902070879936218, 0.9275126457214355, -0.06308729201555252}, {-0.8271039128303528, 0.8586331009864807, -0.12994223833084106}, {-0.8649885654449463, 0.7882442474365234, -0.06598841398954391}, {-0.6895265579223633, 0.6331203579902649, 0.06821846961975098}, {-0.6526296138763428, 0.7019999027252197, 0.13507340848445892}, {-0.614745020866394, 0.772388756275177, 0.07111960649490356}, {-0.6137385368347168, 0.7739266157150269, -0.06214410066604614}, {-0.650635302066803, 0.7050470113754272, -0.12899906933307648}, {-0.688520073890686, 0.63465815782547, -0.06504524499177933}, {-0.4841252863407135, 0.5197523236274719, 0.06821846961975098}, {-0.44722840189933777, 0.5886318683624268, 0.13507340848445892}, {-0.40934380888938904, 0.659020721912384, 0.07111960649490356}, {-0.4083373248577118, 0.6605585813522339, -0.06214410066604614}, {-0.4452340602874756, 0.5916789770126343, -0.12899906933307648}, {-0.48311880230903625, 0.521290123462677, -0.06504524499177933}, {-0.8499264121055603, 1.4175302982330322, 1.0769889513539965e-07}, {-0.785229504108429, 1.4175302982330322, 0.32525306940078735}, {-0.6009885668754578, 1.4175302982330322, 0.6009891033172607}, {-0.3252524435520172, 1.4175302982330322, 0.7852300405502319}, {0.0, 1.4175302982330322, 0.8499268889427185}, {0.3252532482147217, 1.4175302982330322, 0.7852301001548767}, {0.6009894609451294, 1.4175302982330322, 0.6009891033172607}, {0.7852304577827454, 1.4175302982330322, 0.32525286078453064}, {0.8499273061752319, 1.4175302982330322, -2.435454007354565e-07}, {0.785230278968811, 1.4175302982330322, -0.3252532482147217}, {0.6009891033172607, 1.4175302982330322, -0.6009893417358398}, {0.3252526819705963, 1.4175302982330322, -0.7852302193641663}, {0.0, 1.4175302982330322, -0.849926769733429}, {-0.3252533972263336, 1.4175302982330322, -0.7852295637130737}, {-0.6009894013404846, 1.4175302982330322, -0.6009882092475891}, {-0.7852300405502319, 1.4175302982330322, -0.32525163888931274}, {-0.4544179141521454, 0.3115013837814331, -1.4665377534583968e-07}, {-0.5959743857383728, 0.47137248516082764, 1.2302199081659637e-07}, {-0.778468132019043, 1.3382757902145386, 9.581835058725119e-08}, {-0.6776367425918579, 0.8833848237991333, -0.28068533539772034}, {-0.719210684299469, 1.3382757902145386, 0.29790714383125305}, {-0.5506084561347961, 0.47137248516082764, 0.22806976735591888}, {-0.419827401638031, 0.3115013539791107, 0.1738981306552887}, {-0.5186409950256348, 0.8833848237991333, -0.5186400413513184}, {-0.5504599213600159, 1.3382757902145386, 0.5504604578018188}, {-0.4214174151420593, 0.47137251496315, 0.42141783237457275}, {-0.32132190465927124, 0.3115013539791107, 0.321321964263916}, {-0.28068676590919495, 0.8833848237991333, -0.677636444568634}, {-0.2979065775871277, 1.3382757902145386, 0.719211220741272}, {-0.22806930541992188, 0.47137251496315, 0.5506089329719543}, {-0.17389808595180511, 0.3115013837814331, 0.419827401638031}, {0.0, 0.8833847641944885, -0.7334687113761902}, {0.0, 1.3382757902145386, 0.7784686088562012}, {0.0, 0.47137251496315, 0.5959747433662415}, {0.0, 0.3115013837814331, 0.4544179141521454}, {0.28068605065345764, 0.8833848237991333, -0.677636981010437}, {0.29790738224983215, 1.3382757902145386, 0.7192112803459167}, {0.22806985676288605, 0.47137251496315, 0.5506089329719543}, {0.17389841377735138, 0.3115013837814331, 0.4198274612426758}, {0.5186406970024109, 0.8833848237991333, -0.5186411142349243}, {0.5504608750343323, 1.3382757902145386, 0.5504604578018188}, {0.4214180111885071, 0.47137251496315, 0.421417772769928}, {0.3213222920894623, 0.3115013539791107, 0.321321964263916}, {0.6776368618011475, 0.8833848237991333, -0.28068670630455017}, {0.7192116379737854, 1.3382757902145386, 0.2979069650173187}, {0.5506091117858887, 0.47137248516082764, 0.22806960344314575}, {0.41982778906822205, 0.3115013539791107, 0.17389802634716034}, {0.7334690093994141, 0.8833848237991333, -3.094309590778721e-07}, {0.7784690856933594, 1.3382757902145386, -2.258946665278927e-07}, {0.5959749221801758, 0.47137248516082764, -1.2327296872172155e-07}, {0.45441827178001404, 0.3115013539791107, -3.3444845826124947e-07}, {0.6776371002197266, 0.8833848237991333, 0.2806861400604248}, {0.7192114591598511, 1.3382757902145386, -0.2979073226451874}, {0.5506089925765991, 0.47137248516082764, -0.22806982696056366}, {0.4198276698589325, 0.3115013539791107, -0.17389865219593048}, {0.5186409950256348, 0.8833848237991333, 0.5186406373977661}, {0.5504604578018188, 1.3382757902145386, -0.5504606366157532}, {0.421417772769928, 0.47137245535850525, -0.4214179515838623}, {0.32132211327552795, 0.3115013539791107, -0.3213224709033966}, {0.2806865870952606, 0.8833848237991333, 0.6776366233825684}, {0.2979068458080292, 1.3382757902145386, -0.7192113995552063}, {0.22806942462921143, 0.47137245535850525, -0.5506088137626648}, {0.1738981157541275, 0.31150132417678833, -0.4198278486728668}, {0.0, 0.8833848834037781, 0.7334685921669006}, {0.0, 1.3382757902145386, -0.7784684896469116}, {0.0, 0.47137245535850525, -0.5959745645523071}, {0.0, 0.31150132417678833, -0.45441824197769165}, {-0.2806859314441681, 0.8833848237991333, 0.6776366233825684}, {-0.29790744185447693, 1.3382757902145386, -0.7192107439041138}, {-0.22807000577449799, 0.47137245535850525, -0.5506083965301514}, {-0.17389856278896332, 0.31150132417678833, -0.41982749104499817}, {-0.5186402797698975, 0.8833848237991333, 0.5186406373977661}, {-0.5504606366157532, 1.3382757902145386, -0.5504595637321472}, {-0.4214180111885071, 0.47137245535850525, -0.4214170575141907}, {-0.32132232189178467, 0.3115013539791107, -0.32132184505462646}, {-0.6776363253593445, 0.8833848237991333, 0.28068631887435913}, {-0.7192111611366272, 1.3382757902145386, -0.2979058623313904}, {-0.5506088733673096, 0.47137248516082764, -0.22806869447231293}, {-0.4198276400566101, 0.3115013539791107, -0.17389781773090363}, {-0.7334682941436768, 0.8833848237991333, -6.314657241546229e-09}, {-0.22678835690021515, -0.326608806848526, -1.1369904768798733e-06}, {-0.25077199935913086, 0.2286219447851181, -9.208534379467892e-07}, {-0.2316831350326538, 0.22862188518047333, 0.09596532583236694}, {-0.20952512323856354, -0.3266088664531708, 0.08678694814443588}, {-0.1773226112127304, 0.22862190008163452, 0.17732155323028564}, {-0.16036362946033478, -0.3266088664531708, 0.16036230325698853}, {-0.09596636891365051, 0.22862190008163452, 0.23168207705020905}, {-0.08678823709487915, -0.3266088664531708, 0.20952382683753967}, {0.0, 0.22862190008163452, 0.2507709562778473}, {0.0, -0.3266088664531708, 0.22678706049919128}, {0.09596607089042664, 0.22862190008163452, 0.23168204724788666}, {0.0867878869175911, -0.3266088664531708, 0.20952379703521729}, {0.1773223727941513, 0.22862190008163452, 0.17732152342796326}, {0.1603633016347885, -0.3266088664531708, 0.16036230325698853}, {0.23168286681175232, 0.22862188518047333, 0.09596526622772217}, {0.20952479541301727, -0.3266088664531708, 0.08678688853979111}, {0.25077173113822937, 0.22862188518047333, -1.024488483380992e-06}, {0.22678802907466888, -0.3266088664531708, -1.230714133271249e-06}, {0.23168280720710754, 0.22862188518047333, -0.09596728533506393}, {0.2095247507095337, -0.3266088664531708, -0.0867893323302269}, {0.17732222378253937, 0.22862187027931213, -0.17732354998588562}, {0.16036319732666016, -0.3266088664531708, -0.16036470234394073}, {0.0959658995270729, 0.22862187027931213, -0.23168402910232544}, {0.08678773045539856, -0.3266088664531708, -0.2095261961221695}, {0.0, 0.22862187027931213, -0.2507728040218353}, {0.0, -0.3266088664531708, -0.22678935527801514}, {-0.0959666520357132, 0.22862187027931213, -0.23168382048606873}, {-0.08678849041461945, -0.3266088664531708, -0.20952600240707397}, {-0.1773228794336319, 0.22862187027931213, -0.17732317745685577}, {-0.1603638380765915, -0.3266088664531708, -0.16036438941955566}, {-0.23168326914310455, 0.22862188518047333, -0.09596683830022812}, {-0.2095252424478531, -0.3266088664531708, -0.08678892999887466}, {-0.7186056971549988, 1.762908697128296, 1.8773370413782686e-08}, {-0.6639050245285034, 1.762908697128296, 0.2749987542629242}, {-0.5081308484077454, 1.762908697128296, 0.5081313848495483}, {-0.27499818801879883, 1.762908697128296, 0.6639055609703064}, {0.0, 1.762908697128296, 0.7186062335968018}, {0.27499905228614807, 1.762908697128296, 0.6639056205749512}, {0.5081318020820618, 1.762908697128296, 0.5081313252449036}, {0.6639060974121094, 1.762908697128296, 0.27499857544898987}, {0.7186066508293152, 1.762908697128296, -2.120128783644759e-07}, {0.663905918598175, 1.762908697128296, -0.2749989628791809}, {0.5081314444541931, 1.762908697128296, -0.5081315040588379}, {0.27499857544898987, 1.762908697128296, -0.663905680179596}, {0.0, 1.762908697128296, -0.7186061143875122}, {-0.2749989628791809, 1.762908697128296, -0.663905143737793}, {-0.5081315040588379, 1.762908697128296, -0.5081306099891663}, {-0.6639054417610168, 1.762908697128296, -0.2749975621700287}, {-0.5783174633979797, -0.565528154373169, -1.8617564023770683e-07}, {-0.5342956185340881, -0.565528154373169, 0.2213125377893448}, {-0.5342956185340881, -0.4693976640701294, 0.2213125228881836}, {-0.40893200039863586, -0.565528154373169, 0.4089323878288269}, {-0.40893200039863586, -0.469397634267807, 0.4089323878288269}, {-0.22131215035915375, -0.565528154373169, 0.534295916557312}, {-0.22131215035915375, -0.469397634267807, 0.534295916557312}, {0.0, -0.565528154373169, 0.5783177018165588}, {0.0, -0.469397634267807, 0.5783177018165588}, {0.22131313383579254, -0.565528154373169, 0.534295916557312}, {0.22131313383579254, -0.469397634267807, 0.534295916557312}, {0.4089331030845642, -0.565528154373169, 0.40893232822418213}, {0.4089331030845642, -0.469397634267807, 0.40893232822418213}, {0.5342966914176941, -0.565528154373169, 0.22131235897541046}, {0.5342966914176941, -0.4693976640701294, 0.22131234407424927}, {0.5783185362815857, -0.565528154373169, -4.251729137649818e-07}, {0.5783185362815857, -0.4693976640701294, -4.2937492139571987e-07}, {0.5342965126037598, -0.565528154373169, -0.22131319344043732}, {0.5342965126037598, -0.4693976640701294, -0.2213132083415985}, {0.4089328348636627, -0.565528154373169, -0.4089330732822418}, {0.4089328348636627, -0.4693976938724518, -0.4089330732822418}, {0.2213127613067627, -0.565528154373169, -0.5342965722084045}, {0.2213127613067627, -0.4693976938724518, -0.5342965722084045}, {0.0, -0.565528154373169, -0.578318178653717}, {0.0, -0.4693976938724518, -0.578318178653717}, {-0.22131280601024628, -0.565528154373169, -0.5342960953712463}, {-0.22131280601024628, -0.4693976938724518, -0.5342960953712463}, {-0.4089325964450836, -0.565528154373169, -0.4089322090148926}, {-0.4089325964450836, -0.4693976938724518, -0.4089322090148926}, {-0.5342959761619568, -0.565528154373169, -0.22131210565567017}, {-0.5342959761619568, -0.4693976640701294, -0.22131212055683136}, {-0.5783174633979797, -0.4693976640701294, -1.903776336575902e-07}, {-0.8126794099807739, 1.7572910785675049, 0.3366231322288513}, {-0.8796379566192627, 1.7572910785675049, 7.658146472522276e-08}, {-0.6219978332519531, 1.7572910785675049, 0.6219983100891113}, {-0.33662256598472595, 1.7572910785675049, 0.8126799464225769}, {0.0, 1.7572910785675049, 0.8796384930610657}, {0.3366234004497528, 1.7572910785675049, 0.8126800060272217}, {0.6219987869262695, 1.7572910785675049, 0.6219983100891113}, {0.8126804828643799, 1.7572910785675049, 0.336622953414917}, {0.8796389102935791, 1.7572910785675049, -2.8694165621345746e-07}, {0.8126802444458008, 1.7572910785675049, -0.3366234302520752}, {0.6219983696937561, 1.7572910785675049, -0.6219986081123352}, {0.33662283420562744, 1.7572910785675049, -0.8126801252365112}, {0.0, 1.7572910785675049, -0.8796383738517761}, {-0.33662351965904236, 1.7572910785675049, -0.8126794695854187}, {-0.6219986081123352, 1.7572910785675049, -0.6219974160194397}, {-0.8126799464225769, 1.7572910785675049, -0.33662179112434387}, {-0.6639050245285034, 1.4943641424179077, 0.2749987840652466}, {-0.7186056971549988, 1.4943641424179077, 1.612966116226744e-08}, {-0.5081308484077454, 1.4943641424179077, 0.5081313848495483}, {-0.27499818801879883, 1.4943641424179077, 0.6639055609703064}, {0.0, 1.4943641424179077, 0.7186062335968018}, {0.27499905228614807, 1.4943641424179077, 0.6639056205749512}, {0.5081318020820618, 1.4943641424179077, 0.5081313252449036}, {0.6639060974121094, 1.4943641424179077, 0.27499857544898987}, {0.7186066508293152, 1.4943641424179077, -2.146565805105638e-07}, {0.663905918598175, 1.4943641424179077, -0.2749989628791809}, {0.5081314444541931, 1.4943641424179077, -0.5081315040588379}, {0.27499857544898987, 1.4943641424179077, -0.663905680179596}, {0.0, 1.4943641424179077, -0.7186061143875122}, {-0.2749989628791809, 1.4943641424179077, -0.663905143737793}, {-0.5081315040588379, 1.4943641424179077, -0.5081306099891663}, {-0.6639054417610168, 1.4943641424179077, -0.2749975621700287}, {-0.7991217970848083, 1.7976492643356323, 4.4671239152194175e-08}, {-0.7382922768592834, 1.7976492643356323, 0.30581095814704895}, {-0.5650643110275269, 1.7976492643356323, 0.5650648474693298}, {-0.3058103621006012, 1.7976492643356323, 0.7382928133010864}, {0.0, 1.7976492643356323, 0.7991223335266113}, {0.3058112561702728, 1.7976492643356323, 0.7382928133010864}, {0.5650652647018433, 1.7976492643356323, 0.5650647878646851}, {0.7382933497428894, 1.7976492643356323, 0.30581074953079224}, {0.7991227507591248, 1.7976492643356323, -2.5248345991712995e-07}, {0.7382930517196655, 1.7976492643356323, -0.30581119656562805}, {0.5650649070739746, 1.7976492643356323, -0.5650650858879089}, {0.30581071972846985, 1.7976492643356323, -0.738292932510376}, {0.0, 1.7976492643356323, -0.7991222739219666}, {-0.3058112561702728, 1.7976492643356323, -0.7382923364639282}, {-0.5650650262832642, 1.7976492643356323, -0.5650640726089478}, {-0.7382926940917969, 1.7976492643356323, -0.3058096766471863}, {-0.2992255687713623, -0.10140156000852585, -7.516040909649746e-07}, {-0.27644839882850647, -0.10140161961317062, 0.11450789123773575}, {-0.2115844488143921, -0.10140161961317062, 0.21158359944820404}, {-0.114508718252182, -0.10140161216259003, 0.2764475345611572}, {0.0, -0.10140161216259003, 0.29922473430633545}, {0.11450850963592529, -0.10140161216259003, 0.27644750475883484}, {0.21158428490161896, -0.10140161961317062, 0.21158356964588165}, {0.27644819021224976, -0.10140161961317062, 0.11450780928134918}, {0.299225389957428, -0.10140162706375122, -8.752636517783685e-07}, {0.276448130607605, -0.10140163451433182, -0.11450953781604767}, {0.21158412098884583, -0.10140163451433182, -0.21158528327941895}, {0.11450829356908798, -0.10140164196491241, -0.27644917368888855}, {0.0, -0.10140164196491241, -0.2992262542247772}, {-0.11450905352830887, -0.10140164196491241, -0.27644893527030945}, {-0.21158474683761597, -0.10140163451433182, -0.21158483624458313}, {-0.2764485478401184, -0.10140163451433182, -0.11450900137424469}, {-0.484096884727478, -0.4141780138015747, 0.20051926374435425}, {0.3705119490623474, -0.4141779839992523, 0.3705114424228668}, {0.4840971827507019, -0.4141780138015747, 0.2005191147327423}, {0.48409703373908997, -0.4141780138015747, -0.2005201131105423}, {0.0, -0.4141780436038971, -0.5239831805229187}, {0.0, -0.4141779839992523, 0.5239825248718262}, {-0.3705122172832489, -0.4141780436038971, -0.37051162123680115}, {0.20051926374435425, -0.4141780436038971, -0.48409754037857056}, {-0.2005194127559662, -0.4141779839992523, 0.4840966761112213}, {0.5239830017089844, -0.4141780138015747, -5.190973979551927e-07}, {-0.5239827632904053, -0.4141780138015747, -3.025546391199896e-07}, {-0.20051999390125275, -0.4141780436038971, -0.48409706354141235}, {0.2005195915699005, -0.4141779839992523, 0.4840966761112213}, {0.3705116808414459, -0.4141780436038971, -0.370512455701828}, {-0.3705116808414459, -0.4141779839992523, 0.37051156163215637}, {-0.4840972423553467, -0.4141780138015747, -0.20051917433738708}};
+const Vertex verts2[570] = {{0.7205821871757507, 1.6633211374282837, 0.08048629760742188}, {0.784212589263916, 1.6193623542785645, 0.1443706899881363}, {0.8468549847602844, 1.5769133567810059, 0.07744631916284561}, {0.8458486199378967, 1.5784510374069214, -0.05581739544868469}, {0.782218337059021, 1.622409701347351, -0.1197018027305603}, {0.719575822353363, 1.6648590564727783, -0.05277741700410843}, {0.8200704455375671, 1.7909302711486816, 0.08053633570671082}, {0.8695177435874939, 1.7288626432418823, 0.14441464841365814}, {0.9179772138595581, 1.6683045625686646, 0.07748415321111679}, {0.9169707894325256, 1.66984224319458, -0.05577954649925232}, {0.8675234913825989, 1.7319098711013794, -0.11965787410736084}, {0.8190640807151794, 1.7924679517745972, -0.05272737890481949}, {0.974463939666748, 1.855852484703064, 0.07895071059465408}, {0.9876154661178589, 1.7805958986282349, 0.14322766661643982}, {0.999779462814331, 1.7068485021591187, 0.07669586688280106}, {0.9987729787826538, 1.7083863019943237, -0.05656786262989044}, {0.9856213331222534, 1.783643126487732, -0.12084482610225677}, {0.9734574556350708, 1.857390284538269, -0.05431300401687622}, {1.1641303300857544, 1.8265695571899414, 0.07564036548137665}, {1.1225594282150269, 1.7603250741958618, 0.14087945222854614}, {1.080000877380371, 1.6955896615982056, 0.07530978322029114}, {1.0789945125579834, 1.6971274614334106, -0.057953931391239166}, {1.1205650568008423, 1.7633724212646484, -0.12319302558898926}, {1.1631239652633667, 1.828107237815857, -0.057623349130153656}, {1.2866343259811401, 1.607007622718811, 0.07099508494138718}, {1.2137255668640137, 1.5939933061599731, 0.1373858004808426}, {1.139829397201538, 1.5824882984161377, 0.07296775281429291}, {1.1388230323791504, 1.5840259790420532, -0.0602959468960762}, {1.2117314338684082, 1.5970405340194702, -0.1266866773366928}, {1.2856277227401733, 1.6085453033447266, -0.06226862221956253}, {1.2567381858825684, 1.313240647315979, 0.0677884966135025}, {1.186639666557312, 1.3388291597366333, 0.13461795449256897}, {1.115553379058838, 1.365926742553711, 0.07063861936330795}, {1.1145468950271606, 1.367464542388916, -0.06262508779764175}, {1.184645414352417, 1.3418762683868408, -0.12945452332496643}, {1.2557319402694702, 1.314778447151184, -0.0654752105474472}, {1.1092994213104248, 1.0182573795318604, 0.0663914680480957}, {1.050674557685852, 1.06702721118927, 0.13333244621753693}, {0.9910614490509033, 1.1173063516616821, 0.06946467608213425}, {0.9900552034378052, 1.1188443899154663, -0.06379903107881546}, {1.048680305480957, 1.070074439048767, -0.13074001669883728}, {1.108293056488037, 1.0197951793670654, -0.0668722540140152}, {0.8659949898719788, 0.7867064476013184, 0.0672752857208252}, {0.8290981650352478, 0.8555859327316284, 0.13413026928901672}, {0.7912135124206543, 0.9259747266769409, 0.07017643004655838}, {0.7902070879936218, 0.9275126457214355, -0.06308729201555252}, {0.8271039128303528, 0.8586331009864807, -0.12994223833084106}, {0.8649885654449463, 0.7882442474365234, -0.06598841398954391}, {0.6895265579223633, 0.6331203579902649, 0.06821846961975098}, {0.6526296138763428, 0.7019999027252197, 0.13507340848445892}, {0.614745020866394, 0.772388756275177, 0.07111960649490356}, {0.6137385368347168, 0.7739266157150269, -0.06214410066604614}, {0.650635302066803, 0.7050470113754272, -0.12899906933307648}, {0.688520073890686, 0.63465815782547, -0.06504524499177933}, {0.4841252863407135, 0.5197523236274719, 0.06821846961975098}, {0.44722840189933777, 0.5886318683624268, 0.13507340848445892}, {0.40934380888938904, 0.659020721912384, 0.07111960649490356}, {0.4083373248577118, 0.6605585813522339, -0.06214410066604614}, {0.4452340602874756, 0.5916789770126343, -0.12899906933307648}, {0.48311880230903625, 0.521290123462677, -0.06504524499177933}, {0.8499264121055603, 1.4175302982330322, 1.0769889513539965e-07}, {0.785229504108429, 1.4175302982330322, 0.32525306940078735}, {0.6009885668754578, 1.4175302982330322, 0.6009891033172607}, {0.3252524435520172, 1.4175302982330322, 0.7852300405502319}, {-0.3252532482147217, 1.4175302982330322, 0.7852301001548767}, {-0.6009894609451294, 1.4175302982330322, 0.6009891033172607}, {-0.7852304577827454, 1.4175302982330322, 0.32525286078453064}, {-0.8499273061752319, 1.4175302982330322, -2.435454007354565e-07}, {-0.785230278968811, 1.4175302982330322, -0.3252532482147217}, {-0.6009891033172607, 1.4175302982330322, -0.6009893417358398}, {-0.3252526819705963, 1.4175302982330322, -0.7852302193641663}, {0.3252533972263336, 1.4175302982330322, -0.7852295637130737}, {0.6009894013404846, 1.4175302982330322, -0.6009882092475891}, {0.7852300405502319, 1.4175302982330322, -0.32525163888931274}, {0.4544179141521454, 0.3115013837814331, -1.4665377534583968e-07}, {0.5959743857383728, 0.47137248516082764, 1.2302199081659637e-07}, {0.778468132019043, 1.3382757902145386, 9.581835058725119e-08}, {0.6776367425918579, 0.8833848237991333, -0.28068533539772034}, {0.719210684299469, 1.3382757902145386, 0.29790714383125305}, {0.5506084561347961, 0.47137248516082764, 0.22806976735591888}, {0.419827401638031, 0.3115013539791107, 0.1738981306552887}, {0.5186409950256348, 0.8833848237991333, -0.5186400413513184}, {0.5504599213600159, 1.3382757902145386, 0.5504604578018188}, {0.4214174151420593, 0.47137251496315, 0.42141783237457275}, {0.32132190465927124, 0.3115013539791107, 0.321321964263916}, {0.28068676590919495, 0.8833848237991333, -0.677636444568634}, {0.2979065775871277, 1.3382757902145386, 0.719211220741272}, {0.22806930541992188, 0.47137251496315, 0.5506089329719543}, {0.17389808595180511, 0.3115013837814331, 0.419827401638031}, {-0.28068605065345764, 0.8833848237991333, -0.677636981010437}, {-0.29790738224983215, 1.3382757902145386, 0.7192112803459167}, {-0.22806985676288605, 0.47137251496315, 0.5506089329719543}, {-0.17389841377735138, 0.3115013837814331, 0.4198274612426758}, {-0.5186406970024109, 0.8833848237991333, -0.5186411142349243}, {-0.5504608750343323, 1.3382757902145386, 0.5504604578018188}, {-0.4214180111885071, 0.47137251496315, 0.421417772769928}, {-0.3213222920894623, 0.3115013539791107, 0.321321964263916}, {-0.6776368618011475, 0.8833848237991333, -0.28068670630455017}, {-0.7192116379737854, 1.3382757902145386, 0.2979069650173187}, {-0.5506091117858887, 0.47137248516082764, 0.22806960344314575}, {-0.41982778906822205, 0.3115013539791107, 0.17389802634716034}, {-0.7334690093994141, 0.8833848237991333, -3.094309590778721e-07}, {-0.7784690856933594, 1.3382757902145386, -2.258946665278927e-07}, {-0.5959749221801758, 0.47137248516082764, -1.2327296872172155e-07}, {-0.45441827178001404, 0.3115013539791107, -3.3444845826124947e-07}, {-0.6776371002197266, 0.8833848237991333, 0.2806861400604248}, {-0.7192114591598511, 1.3382757902145386, -0.2979073226451874}, {-0.5506089925765991, 0.47137248516082764, -0.22806982696056366}, {-0.4198276698589325, 0.3115013539791107, -0.17389865219593048}, {-0.5186409950256348, 0.8833848237991333, 0.5186406373977661}, {-0.5504604578018188, 1.3382757902145386, -0.5504606366157532}, {-0.421417772769928, 0.47137245535850525, -0.4214179515838623}, {-0.32132211327552795, 0.3115013539791107, -0.3213224709033966}, {-0.2806865870952606, 0.8833848237991333, 0.6776366233825684}, {-0.2979068458080292, 1.3382757902145386, -0.7192113995552063}, {-0.22806942462921143, 0.47137245535850525, -0.5506088137626648}, {-0.1738981157541275, 0.31150132417678833, -0.4198278486728668}, {0.2806859314441681, 0.8833848237991333, 0.6776366233825684}, {0.29790744185447693, 1.3382757902145386, -0.7192107439041138}, {0.22807000577449799, 0.47137245535850525, -0.5506083965301514}, {0.17389856278896332, 0.31150132417678833, -0.41982749104499817}, {0.5186402797698975, 0.8833848237991333, 0.5186406373977661}, {0.5504606366157532, 1.3382757902145386, -0.5504595637321472}, {0.4214180111885071, 0.47137245535850525, -0.4214170575141907}, {0.32132232189178467, 0.3115013539791107, -0.32132184505462646}, {0.6776363253593445, 0.8833848237991333, 0.28068631887435913}, {0.7192111611366272, 1.3382757902145386, -0.2979058623313904}, {0.5506088733673096, 0.47137248516082764, -0.22806869447231293}, {0.4198276400566101, 0.3115013539791107, -0.17389781773090363}, {0.7334682941436768, 0.8833848237991333, -6.314657241546229e-09}, {0.22678835690021515, -0.326608806848526, -1.1369904768798733e-06}, {0.25077199935913086, 0.2286219447851181, -9.208534379467892e-07}, {0.2316831350326538, 0.22862188518047333, 0.09596532583236694}, {0.20952512323856354, -0.3266088664531708, 0.08678694814443588}, {0.1773226112127304, 0.22862190008163452, 0.17732155323028564}, {0.16036362946033478, -0.3266088664531708, 0.16036230325698853}, {0.09596636891365051, 0.22862190008163452, 0.23168207705020905}, {0.08678823709487915, -0.3266088664531708, 0.20952382683753967}, {-0.09596607089042664, 0.22862190008163452, 0.23168204724788666}, {-0.0867878869175911, -0.3266088664531708, 0.20952379703521729}, {-0.1773223727941513, 0.22862190008163452, 0.17732152342796326}, {-0.1603633016347885, -0.3266088664531708, 0.16036230325698853}, {-0.23168286681175232, 0.22862188518047333, 0.09596526622772217}, {-0.20952479541301727, -0.3266088664531708, 0.08678688853979111}, {-0.25077173113822937, 0.22862188518047333, -1.024488483380992e-06}, {-0.22678802907466888, -0.3266088664531708, -1.230714133271249e-06}, {-0.23168280720710754, 0.22862188518047333, -0.09596728533506393}, {-0.2095247507095337, -0.3266088664531708, -0.0867893323302269}, {-0.17732222378253937, 0.22862187027931213, -0.17732354998588562}, {-0.16036319732666016, -0.3266088664531708, -0.16036470234394073}, {-0.0959658995270729, 0.22862187027931213, -0.23168402910232544}, {-0.08678773045539856, -0.3266088664531708, -0.2095261961221695}, {0.0959666520357132, 0.22862187027931213, -0.23168382048606873}, {0.08678849041461945, -0.3266088664531708, -0.20952600240707397}, {0.1773228794336319, 0.22862187027931213, -0.17732317745685577}, {0.1603638380765915, -0.3266088664531708, -0.16036438941955566}, {0.23168326914310455, 0.22862188518047333, -0.09596683830022812}, {0.2095252424478531, -0.3266088664531708, -0.08678892999887466}, {0.7186056971549988, 1.762908697128296, 1.8773370413782686e-08}, {0.6639050245285034, 1.762908697128296, 0.2749987542629242}, {0.5081308484077454, 1.762908697128296, 0.5081313848495483}, {0.27499818801879883, 1.762908697128296, 0.6639055609703064}, {-0.27499905228614807, 1.762908697128296, 0.6639056205749512}, {-0.5081318020820618, 1.762908697128296, 0.5081313252449036}, {-0.6639060974121094, 1.762908697128296, 0.27499857544898987}, {-0.7186066508293152, 1.762908697128296, -2.120128783644759e-07}, {-0.663905918598175, 1.762908697128296, -0.2749989628791809}, {-0.5081314444541931, 1.762908697128296, -0.5081315040588379}, {-0.27499857544898987, 1.762908697128296, -0.663905680179596}, {0.2749989628791809, 1.762908697128296, -0.663905143737793}, {0.5081315040588379, 1.762908697128296, -0.5081306099891663}, {0.6639054417610168, 1.762908697128296, -0.2749975621700287}, {0.5783174633979797, -0.565528154373169, -1.8617564023770683e-07}, {0.5342956185340881, -0.565528154373169, 0.2213125377893448}, {0.5342956185340881, -0.4693976640701294, 0.2213125228881836}, {0.40893200039863586, -0.565528154373169, 0.4089323878288269}, {0.40893200039863586, -0.469397634267807, 0.4089323878288269}, {0.22131215035915375, -0.565528154373169, 0.534295916557312}, {0.22131215035915375, -0.469397634267807, 0.534295916557312}, {-0.22131313383579254, -0.565528154373169, 0.534295916557312}, {-0.22131313383579254, -0.469397634267807, 0.534295916557312}, {-0.4089331030845642, -0.565528154373169, 0.40893232822418213}, {-0.4089331030845642, -0.469397634267807, 0.40893232822418213}, {-0.5342966914176941, -0.565528154373169, 0.22131235897541046}, {-0.5342966914176941, -0.4693976640701294, 0.22131234407424927}, {-0.5783185362815857, -0.565528154373169, -4.251729137649818e-07}, {-0.5783185362815857, -0.4693976640701294, -4.2937492139571987e-07}, {-0.5342965126037598, -0.565528154373169, -0.22131319344043732}, {-0.5342965126037598, -0.4693976640701294, -0.2213132083415985}, {-0.4089328348636627, -0.565528154373169, -0.4089330732822418}, {-0.4089328348636627, -0.4693976938724518, -0.4089330732822418}, {-0.2213127613067627, -0.565528154373169, -0.5342965722084045}, {-0.2213127613067627, -0.4693976938724518, -0.5342965722084045}, {0.22131280601024628, -0.565528154373169, -0.5342960953712463}, {0.22131280601024628, -0.4693976938724518, -0.5342960953712463}, {0.4089325964450836, -0.565528154373169, -0.4089322090148926}, {0.4089325964450836, -0.4693976938724518, -0.4089322090148926}, {0.5342959761619568, -0.565528154373169, -0.22131210565567017}, {0.5342959761619568, -0.4693976640701294, -0.22131212055683136}, {0.5783174633979797, -0.4693976640701294, -1.903776336575902e-07}, {0.8126794099807739, 1.7572910785675049, 0.3366231322288513}, {0.8796379566192627, 1.7572910785675049, 7.658146472522276e-08}, {0.6219978332519531, 1.7572910785675049, 0.6219983100891113}, {0.33662256598472595, 1.7572910785675049, 0.8126799464225769}, {-0.3366234004497528, 1.7572910785675049, 0.8126800060272217}, {-0.6219987869262695, 1.7572910785675049, 0.6219983100891113}, {-0.8126804828643799, 1.7572910785675049, 0.336622953414917}, {-0.8796389102935791, 1.7572910785675049, -2.8694165621345746e-07}, {-0.8126802444458008, 1.7572910785675049, -0.3366234302520752}, {-0.6219983696937561, 1.7572910785675049, -0.6219986081123352}, {-0.33662283420562744, 1.7572910785675049, -0.8126801252365112}, {0.33662351965904236, 1.7572910785675049, -0.8126794695854187}, {0.6219986081123352, 1.7572910785675049, -0.6219974160194397}, {0.8126799464225769, 1.7572910785675049, -0.33662179112434387}, {0.6639050245285034, 1.4943641424179077, 0.2749987840652466}, {0.7186056971549988, 1.4943641424179077, 1.612966116226744e-08}, {0.5081308484077454, 1.4943641424179077, 0.5081313848495483}, {0.27499818801879883, 1.4943641424179077, 0.6639055609703064}, {-0.27499905228614807, 1.4943641424179077, 0.6639056205749512}, {-0.5081318020820618, 1.4943641424179077, 0.5081313252449036}, {-0.6639060974121094, 1.4943641424179077, 0.27499857544898987}, {-0.7186066508293152, 1.4943641424179077, -2.146565805105638e-07}, {-0.663905918598175, 1.4943641424179077, -0.2749989628791809}, {-0.5081314444541931, 1.4943641424179077, -0.5081315040588379}, {-0.27499857544898987, 1.4943641424179077, -0.663905680179596}, {0.2749989628791809, 1.4943641424179077, -0.663905143737793}, {0.5081315040588379, 1.4943641424179077, -0.5081306099891663}, {0.6639054417610168, 1.4943641424179077, -0.2749975621700287}, {0.7991217970848083, 1.7976492643356323, 4.4671239152194175e-08}, {0.7382922768592834, 1.7976492643356323, 0.30581095814704895}, {0.5650643110275269, 1.7976492643356323, 0.5650648474693298}, {0.3058103621006012, 1.7976492643356323, 0.7382928133010864}, {-0.3058112561702728, 1.7976492643356323, 0.7382928133010864}, {-0.5650652647018433, 1.7976492643356323, 0.5650647878646851}, {-0.7382933497428894, 1.7976492643356323, 0.30581074953079224}, {-0.7991227507591248, 1.7976492643356323, -2.5248345991712995e-07}, {-0.7382930517196655, 1.7976492643356323, -0.30581119656562805}, {-0.5650649070739746, 1.7976492643356323, -0.5650650858879089}, {-0.30581071972846985, 1.7976492643356323, -0.738292932510376}, {0.3058112561702728, 1.7976492643356323, -0.7382923364639282}, {0.5650650262832642, 1.7976492643356323, -0.5650640726089478}, {0.7382926940917969, 1.7976492643356323, -0.3058096766471863}, {0.2992255687713623, -0.10140156000852585, -7.516040909649746e-07}, {0.27644839882850647, -0.10140161961317062, 0.11450789123773575}, {0.2115844488143921, -0.10140161961317062, 0.21158359944820404}, {0.114508718252182, -0.10140161216259003, 0.2764475345611572}, {-0.11450850963592529, -0.10140161216259003, 0.27644750475883484}, {-0.21158428490161896, -0.10140161961317062, 0.21158356964588165}, {-0.27644819021224976, -0.10140161961317062, 0.11450780928134918}, {-0.299225389957428, -0.10140162706375122, -8.752636517783685e-07}, {-0.276448130607605, -0.10140163451433182, -0.11450953781604767}, {-0.21158412098884583, -0.10140163451433182, -0.21158528327941895}, {-0.11450829356908798, -0.10140164196491241, -0.27644917368888855}, {0.11450905352830887, -0.10140164196491241, -0.27644893527030945}, {0.21158474683761597, -0.10140163451433182, -0.21158483624458313}, {0.2764485478401184, -0.10140163451433182, -0.11450900137424469}, {0.484096884727478, -0.4141780138015747, 0.20051926374435425}, {-0.3705119490623474, -0.4141779839992523, 0.3705114424228668}, {-0.4840971827507019, -0.4141780138015747, 0.2005191147327423}, {-0.48409703373908997, -0.4141780138015747, -0.2005201131105423}, {0.3705122172832489, -0.4141780436038971, -0.37051162123680115}, {-0.20051926374435425, -0.4141780436038971, -0.48409754037857056}, {0.2005194127559662, -0.4141779839992523, 0.4840966761112213}, {-0.5239830017089844, -0.4141780138015747, -5.190973979551927e-07}, {0.5239827632904053, -0.4141780138015747, -3.025546391199896e-07}, {0.20051999390125275, -0.4141780436038971, -0.48409706354141235}, {-0.2005195915699005, -0.4141779839992523, 0.4840966761112213}, {-0.3705116808414459, -0.4141780436038971, -0.370512455701828}, {0.3705116808414459, -0.4141779839992523, 0.37051156163215637}, {0.4840972423553467, -0.4141780138015747, -0.20051917433738708}, {-0.7205821871757507, 1.6633211374282837, 0.08048629760742188}, {-0.784212589263916, 1.6193623542785645, 0.1443706899881363}, {-0.8468549847602844, 1.5769133567810059, 0.07744631916284561}, {-0.8458486199378967, 1.5784510374069214, -0.05581739544868469}, {-0.782218337059021, 1.622409701347351, -0.1197018027305603}, {-0.719575822353363, 1.6648590564727783, -0.05277741700410843}, {-0.8200704455375671, 1.7909302711486816, 0.08053633570671082}, {-0.8695177435874939, 1.7288626432418823, 0.14441464841365814}, {-0.9179772138595581, 1.6683045625686646, 0.07748415321111679}, {-0.9169707894325256, 1.66984224319458, -0.05577954649925232}, {-0.8675234913825989, 1.7319098711013794, -0.11965787410736084}, {-0.8190640807151794, 1.7924679517745972, -0.05272737890481949}, {-0.974463939666748, 1.855852484703064, 0.07895071059465408}, {-0.9876154661178589, 1.7805958986282349, 0.14322766661643982}, {-0.999779462814331, 1.7068485021591187, 0.07669586688280106}, {-0.9987729787826538, 1.7083863019943237, -0.05656786262989044}, {-0.9856213331222534, 1.783643126487732, -0.12084482610225677}, {-0.9734574556350708, 1.857390284538269, -0.05431300401687622}, {-1.1641303300857544, 1.8265695571899414, 0.07564036548137665}, {-1.1225594282150269, 1.7603250741958618, 0.14087945222854614}, {-1.080000877380371, 1.6955896615982056, 0.07530978322029114}, {-1.0789945125579834, 1.6971274614334106, -0.057953931391239166}, {-1.1205650568008423, 1.7633724212646484, -0.12319302558898926}, {-1.1631239652633667, 1.828107237815857, -0.057623349130153656}, {-1.2866343259811401, 1.607007622718811, 0.07099508494138718}, {-1.2137255668640137, 1.5939933061599731, 0.1373858004808426}, {-1.139829397201538, 1.5824882984161377, 0.07296775281429291}, {-1.1388230323791504, 1.5840259790420532, -0.0602959468960762}, {-1.2117314338684082, 1.5970405340194702, -0.1266866773366928}, {-1.2856277227401733, 1.6085453033447266, -0.06226862221956253}, {-1.2567381858825684, 1.313240647315979, 0.0677884966135025}, {-1.186639666557312, 1.3388291597366333, 0.13461795449256897}, {-1.115553379058838, 1.365926742553711, 0.07063861936330795}, {-1.1145468950271606, 1.367464542388916, -0.06262508779764175}, {-1.184645414352417, 1.3418762683868408, -0.12945452332496643}, {-1.2557319402694702, 1.314778447151184, -0.0654752105474472}, {-1.1092994213104248, 1.0182573795318604, 0.0663914680480957}, {-1.050674557685852, 1.06702721118927, 0.13333244621753693}, {-0.9910614490509033, 1.1173063516616821, 0.06946467608213425}, {-0.9900552034378052, 1.1188443899154663, -0.06379903107881546}, {-1.048680305480957, 1.070074439048767, -0.13074001669883728}, {-1.108293056488037, 1.0197951793670654, -0.0668722540140152}, {-0.8659949898719788, 0.7867064476013184, 0.0672752857208252}, {-0.8290981650352478, 0.8555859327316284, 0.13413026928901672}, {-0.7912135124206543, 0.9259747266769409, 0.07017643004655838}, {-0.7902070879936218, 0.9275126457214355, -0.06308729201555252}, {-0.8271039128303528, 0.8586331009864807, -0.12994223833084106}, {-0.8649885654449463, 0.7882442474365234, -0.06598841398954391}, {-0.6895265579223633, 0.6331203579902649, 0.06821846961975098}, {-0.6526296138763428, 0.7019999027252197, 0.13507340848445892}, {-0.614745020866394, 0.772388756275177, 0.07111960649490356}, {-0.6137385368347168, 0.7739266157150269, -0.06214410066604614}, {-0.650635302066803, 0.7050470113754272, -0.12899906933307648}, {-0.688520073890686, 0.63465815782547, -0.06504524499177933}, {-0.4841252863407135, 0.5197523236274719, 0.06821846961975098}, {-0.44722840189933777, 0.5886318683624268, 0.13507340848445892}, {-0.40934380888938904, 0.659020721912384, 0.07111960649490356}, {-0.4083373248577118, 0.6605585813522339, -0.06214410066604614}, {-0.4452340602874756, 0.5916789770126343, -0.12899906933307648}, {-0.48311880230903625, 0.521290123462677, -0.06504524499177933}, {-0.8499264121055603, 1.4175302982330322, 1.0769889513539965e-07}, {-0.785229504108429, 1.4175302982330322, 0.32525306940078735}, {-0.6009885668754578, 1.4175302982330322, 0.6009891033172607}, {-0.3252524435520172, 1.4175302982330322, 0.7852300405502319}, {0.0, 1.4175302982330322, 0.8499268889427185}, {0.3252532482147217, 1.4175302982330322, 0.7852301001548767}, {0.6009894609451294, 1.4175302982330322, 0.6009891033172607}, {0.7852304577827454, 1.4175302982330322, 0.32525286078453064}, {0.8499273061752319, 1.4175302982330322, -2.435454007354565e-07}, {0.785230278968811, 1.4175302982330322, -0.3252532482147217}, {0.6009891033172607, 1.4175302982330322, -0.6009893417358398}, {0.3252526819705963, 1.4175302982330322, -0.7852302193641663}, {0.0, 1.4175302982330322, -0.849926769733429}, {-0.3252533972263336, 1.4175302982330322, -0.7852295637130737}, {-0.6009894013404846, 1.4175302982330322, -0.6009882092475891}, {-0.7852300405502319, 1.4175302982330322, -0.32525163888931274}, {-0.4544179141521454, 0.3115013837814331, -1.4665377534583968e-07}, {-0.5959743857383728, 0.47137248516082764, 1.2302199081659637e-07}, {-0.778468132019043, 1.3382757902145386, 9.581835058725119e-08}, {-0.6776367425918579, 0.8833848237991333, -0.28068533539772034}, {-0.719210684299469, 1.3382757902145386, 0.29790714383125305}, {-0.5506084561347961, 0.47137248516082764, 0.22806976735591888}, {-0.419827401638031, 0.3115013539791107, 0.1738981306552887}, {-0.5186409950256348, 0.8833848237991333, -0.5186400413513184}, {-0.5504599213600159, 1.3382757902145386, 0.5504604578018188}, {-0.4214174151420593, 0.47137251496315, 0.42141783237457275}, {-0.32132190465927124, 0.3115013539791107, 0.321321964263916}, {-0.28068676590919495, 0.8833848237991333, -0.677636444568634}, {-0.2979065775871277, 1.3382757902145386, 0.719211220741272}, {-0.22806930541992188, 0.47137251496315, 0.5506089329719543}, {-0.17389808595180511, 0.3115013837814331, 0.419827401638031}, {0.0, 0.8833847641944885, -0.7334687113761902}, {0.0, 1.3382757902145386, 0.7784686088562012}, {0.0, 0.47137251496315, 0.5959747433662415}, {0.0, 0.3115013837814331, 0.4544179141521454}, {0.28068605065345764, 0.8833848237991333, -0.677636981010437}, {0.29790738224983215, 1.3382757902145386, 0.7192112803459167}, {0.22806985676288605, 0.47137251496315, 0.5506089329719543}, {0.17389841377735138, 0.3115013837814331, 0.4198274612426758}, {0.5186406970024109, 0.8833848237991333, -0.5186411142349243}, {0.5504608750343323, 1.3382757902145386, 0.5504604578018188}, {0.4214180111885071, 0.47137251496315, 0.421417772769928}, {0.3213222920894623, 0.3115013539791107, 0.321321964263916}, {0.6776368618011475, 0.8833848237991333, -0.28068670630455017}, {0.7192116379737854, 1.3382757902145386, 0.2979069650173187}, {0.5506091117858887, 0.47137248516082764, 0.22806960344314575}, {0.41982778906822205, 0.3115013539791107, 0.17389802634716034}, {0.7334690093994141, 0.8833848237991333, -3.094309590778721e-07}, {0.7784690856933594, 1.3382757902145386, -2.258946665278927e-07}, {0.5959749221801758, 0.47137248516082764, -1.2327296872172155e-07}, {0.45441827178001404, 0.3115013539791107, -3.3444845826124947e-07}, {0.6776371002197266, 0.8833848237991333, 0.2806861400604248}, {0.7192114591598511, 1.3382757902145386, -0.2979073226451874}, {0.5506089925765991, 0.47137248516082764, -0.22806982696056366}, {0.4198276698589325, 0.3115013539791107, -0.17389865219593048}, {0.5186409950256348, 0.8833848237991333, 0.5186406373977661}, {0.5504604578018188, 1.3382757902145386, -0.5504606366157532}, {0.421417772769928, 0.47137245535850525, -0.4214179515838623}, {0.32132211327552795, 0.3115013539791107, -0.3213224709033966}, {0.2806865870952606, 0.8833848237991333, 0.6776366233825684}, {0.2979068458080292, 1.3382757902145386, -0.7192113995552063}, {0.22806942462921143, 0.47137245535850525, -0.5506088137626648}, {0.1738981157541275, 0.31150132417678833, -0.4198278486728668}, {0.0, 0.8833848834037781, 0.7334685921669006}, {0.0, 1.3382757902145386, -0.7784684896469116}, {0.0, 0.47137245535850525, -0.5959745645523071}, {0.0, 0.31150132417678833, -0.45441824197769165}, {-0.2806859314441681, 0.8833848237991333, 0.6776366233825684}, {-0.29790744185447693, 1.3382757902145386, -0.7192107439041138}, {-0.22807000577449799, 0.47137245535850525, -0.5506083965301514}, {-0.17389856278896332, 0.31150132417678833, -0.41982749104499817}, {-0.5186402797698975, 0.8833848237991333, 0.5186406373977661}, {-0.5504606366157532, 1.3382757902145386, -0.5504595637321472}, {-0.4214180111885071, 0.47137245535850525, -0.4214170575141907}, {-0.32132232189178467, 0.3115013539791107, -0.32132184505462646}, {-0.6776363253593445, 0.8833848237991333, 0.28068631887435913}, {-0.7192111611366272, 1.3382757902145386, -0.2979058623313904}, {-0.5506088733673096, 0.47137248516082764, -0.22806869447231293}, {-0.4198276400566101, 0.3115013539791107, -0.17389781773090363}, {-0.7334682941436768, 0.8833848237991333, -6.314657241546229e-09}, {-0.22678835690021515, -0.326608806848526, -1.1369904768798733e-06}, {-0.25077199935913086, 0.2286219447851181, -9.208534379467892e-07}, {-0.2316831350326538, 0.22862188518047333, 0.09596532583236694}, {-0.20952512323856354, -0.3266088664531708, 0.08678694814443588}, {-0.1773226112127304, 0.22862190008163452, 0.17732155323028564}, {-0.16036362946033478, -0.3266088664531708, 0.16036230325698853}, {-0.09596636891365051, 0.22862190008163452, 0.23168207705020905}, {-0.08678823709487915, -0.3266088664531708, 0.20952382683753967}, {0.0, 0.22862190008163452, 0.2507709562778473}, {0.0, -0.3266088664531708, 0.22678706049919128}, {0.09596607089042664, 0.22862190008163452, 0.23168204724788666}, {0.0867878869175911, -0.3266088664531708, 0.20952379703521729}, {0.1773223727941513, 0.22862190008163452, 0.17732152342796326}, {0.1603633016347885, -0.3266088664531708, 0.16036230325698853}, {0.23168286681175232, 0.22862188518047333, 0.09596526622772217}, {0.20952479541301727, -0.3266088664531708, 0.08678688853979111}, {0.25077173113822937, 0.22862188518047333, -1.024488483380992e-06}, {0.22678802907466888, -0.3266088664531708, -1.230714133271249e-06}, {0.23168280720710754, 0.22862188518047333, -0.09596728533506393}, {0.2095247507095337, -0.3266088664531708, -0.0867893323302269}, {0.17732222378253937, 0.22862187027931213, -0.17732354998588562}, {0.16036319732666016, -0.3266088664531708, -0.16036470234394073}, {0.0959658995270729, 0.22862187027931213, -0.23168402910232544}, {0.08678773045539856, -0.3266088664531708, -0.2095261961221695}, {0.0, 0.22862187027931213, -0.2507728040218353}, {0.0, -0.3266088664531708, -0.22678935527801514}, {-0.0959666520357132, 0.22862187027931213, -0.23168382048606873}, {-0.08678849041461945, -0.3266088664531708, -0.20952600240707397}, {-0.1773228794336319, 0.22862187027931213, -0.17732317745685577}, {-0.1603638380765915, -0.3266088664531708, -0.16036438941955566}, {-0.23168326914310455, 0.22862188518047333, -0.09596683830022812}, {-0.2095252424478531, -0.3266088664531708, -0.08678892999887466}, {-0.7186056971549988, 1.762908697128296, 1.8773370413782686e-08}, {-0.6639050245285034, 1.762908697128296, 0.2749987542629242}, {-0.5081308484077454, 1.762908697128296, 0.5081313848495483}, {-0.27499818801879883, 1.762908697128296, 0.6639055609703064}, {0.0, 1.762908697128296, 0.7186062335968018}, {0.27499905228614807, 1.762908697128296, 0.6639056205749512}, {0.5081318020820618, 1.762908697128296, 0.5081313252449036}, {0.6639060974121094, 1.762908697128296, 0.27499857544898987}, {0.7186066508293152, 1.762908697128296, -2.120128783644759e-07}, {0.663905918598175, 1.762908697128296, -0.2749989628791809}, {0.5081314444541931, 1.762908697128296, -0.5081315040588379}, {0.27499857544898987, 1.762908697128296, -0.663905680179596}, {0.0, 1.762908697128296, -0.7186061143875122}, {-0.2749989628791809, 1.762908697128296, -0.663905143737793}, {-0.5081315040588379, 1.762908697128296, -0.5081306099891663}, {-0.6639054417610168, 1.762908697128296, -0.2749975621700287}, {-0.5783174633979797, -0.565528154373169, -1.8617564023770683e-07}, {-0.5342956185340881, -0.565528154373169, 0.2213125377893448}, {-0.5342956185340881, -0.4693976640701294, 0.2213125228881836}, {-0.40893200039863586, -0.565528154373169, 0.4089323878288269}, {-0.40893200039863586, -0.469397634267807, 0.4089323878288269}, {-0.22131215035915375, -0.565528154373169, 0.534295916557312}, {-0.22131215035915375, -0.469397634267807, 0.534295916557312}, {0.0, -0.565528154373169, 0.5783177018165588}, {0.0, -0.469397634267807, 0.5783177018165588}, {0.22131313383579254, -0.565528154373169, 0.534295916557312}, {0.22131313383579254, -0.469397634267807, 0.534295916557312}, {0.4089331030845642, -0.565528154373169, 0.40893232822418213}, {0.4089331030845642, -0.469397634267807, 0.40893232822418213}, {0.5342966914176941, -0.565528154373169, 0.22131235897541046}, {0.5342966914176941, -0.4693976640701294, 0.22131234407424927}, {0.5783185362815857, -0.565528154373169, -4.251729137649818e-07}, {0.5783185362815857, -0.4693976640701294, -4.2937492139571987e-07}, {0.5342965126037598, -0.565528154373169, -0.22131319344043732}, {0.5342965126037598, -0.4693976640701294, -0.2213132083415985}, {0.4089328348636627, -0.565528154373169, -0.4089330732822418}, {0.4089328348636627, -0.4693976938724518, -0.4089330732822418}, {0.2213127613067627, -0.565528154373169, -0.5342965722084045}, {0.2213127613067627, -0.4693976938724518, -0.5342965722084045}, {0.0, -0.565528154373169, -0.578318178653717}, {0.0, -0.4693976938724518, -0.578318178653717}, {-0.22131280601024628, -0.565528154373169, -0.5342960953712463}, {-0.22131280601024628, -0.4693976938724518, -0.5342960953712463}, {-0.4089325964450836, -0.565528154373169, -0.4089322090148926}, {-0.4089325964450836, -0.4693976938724518, -0.4089322090148926}, {-0.5342959761619568, -0.565528154373169, -0.22131210565567017}, {-0.5342959761619568, -0.4693976640701294, -0.22131212055683136}, {-0.5783174633979797, -0.4693976640701294, -1.903776336575902e-07}, {-0.8126794099807739, 1.7572910785675049, 0.3366231322288513}, {-0.8796379566192627, 1.7572910785675049, 7.658146472522276e-08}, {-0.6219978332519531, 1.7572910785675049, 0.6219983100891113}, {-0.33662256598472595, 1.7572910785675049, 0.8126799464225769}, {0.0, 1.7572910785675049, 0.8796384930610657}, {0.3366234004497528, 1.7572910785675049, 0.8126800060272217}, {0.6219987869262695, 1.7572910785675049, 0.6219983100891113}, {0.8126804828643799, 1.7572910785675049, 0.336622953414917}, {0.8796389102935791, 1.7572910785675049, -2.8694165621345746e-07}, {0.8126802444458008, 1.7572910785675049, -0.3366234302520752}, {0.6219983696937561, 1.7572910785675049, -0.6219986081123352}, {0.33662283420562744, 1.7572910785675049, -0.8126801252365112}, {0.0, 1.7572910785675049, -0.8796383738517761}, {-0.33662351965904236, 1.7572910785675049, -0.8126794695854187}, {-0.6219986081123352, 1.7572910785675049, -0.6219974160194397}, {-0.8126799464225769, 1.7572910785675049, -0.33662179112434387}, {-0.6639050245285034, 1.4943641424179077, 0.2749987840652466}, {-0.7186056971549988, 1.4943641424179077, 1.612966116226744e-08}, {-0.5081308484077454, 1.4943641424179077, 0.5081313848495483}, {-0.27499818801879883, 1.4943641424179077, 0.6639055609703064}, {0.0, 1.4943641424179077, 0.7186062335968018}, {0.27499905228614807, 1.4943641424179077, 0.6639056205749512}, {0.5081318020820618, 1.4943641424179077, 0.5081313252449036}, {0.6639060974121094, 1.4943641424179077, 0.27499857544898987}, {0.7186066508293152, 1.4943641424179077, -2.146565805105638e-07}, {0.663905918598175, 1.4943641424179077, -0.2749989628791809}, {0.5081314444541931, 1.4943641424179077, -0.5081315040588379}, {0.27499857544898987, 1.4943641424179077, -0.663905680179596}, {0.0, 1.4943641424179077, -0.7186061143875122}, {-0.2749989628791809, 1.4943641424179077, -0.663905143737793}, {-0.5081315040588379, 1.4943641424179077, -0.5081306099891663}, {-0.6639054417610168, 1.4943641424179077, -0.2749975621700287}, {-0.7991217970848083, 1.7976492643356323, 4.4671239152194175e-08}, {-0.7382922768592834, 1.7976492643356323, 0.30581095814704895}, {-0.5650643110275269, 1.7976492643356323, 0.5650648474693298}, {-0.3058103621006012, 1.7976492643356323, 0.7382928133010864}, {0.0, 1.7976492643356323, 0.7991223335266113}, {0.3058112561702728, 1.7976492643356323, 0.7382928133010864}, {0.5650652647018433, 1.7976492643356323, 0.5650647878646851}, {0.7382933497428894, 1.7976492643356323, 0.30581074953079224}, {0.7991227507591248, 1.7976492643356323, -2.5248345991712995e-07}, {0.7382930517196655, 1.7976492643356323, -0.30581119656562805}, {0.5650649070739746, 1.7976492643356323, -0.5650650858879089}, {0.30581071972846985, 1.7976492643356323, -0.738292932510376}, {0.0, 1.7976492643356323, -0.7991222739219666}, {-0.3058112561702728, 1.7976492643356323, -0.7382923364639282}, {-0.5650650262832642, 1.7976492643356323, -0.5650640726089478}, {-0.7382926940917969, 1.7976492643356323, -0.3058096766471863}, {-0.2992255687713623, -0.10140156000852585, -7.516040909649746e-07}, {-0.27644839882850647, -0.10140161961317062, 0.11450789123773575}, {-0.2115844488143921, -0.10140161961317062, 0.21158359944820404}, {-0.114508718252182, -0.10140161216259003, 0.2764475345611572}, {0.0, -0.10140161216259003, 0.29922473430633545}, {0.11450850963592529, -0.10140161216259003, 0.27644750475883484}, {0.21158428490161896, -0.10140161961317062, 0.21158356964588165}, {0.27644819021224976, -0.10140161961317062, 0.11450780928134918}, {0.299225389957428, -0.10140162706375122, -8.752636517783685e-07}, {0.276448130607605, -0.10140163451433182, -0.11450953781604767}, {0.21158412098884583, -0.10140163451433182, -0.21158528327941895}, {0.11450829356908798, -0.10140164196491241, -0.27644917368888855}, {0.0, -0.10140164196491241, -0.2992262542247772}, {-0.11450905352830887, -0.10140164196491241, -0.27644893527030945}, {-0.21158474683761597, -0.10140163451433182, -0.21158483624458313}, {-0.2764485478401184, -0.10140163451433182, -0.11450900137424469}, {-0.484096884727478, -0.4141780138015747, 0.20051926374435425}, {0.3705119490623474, -0.4141779839992523, 0.3705114424228668}, {0.4840971827507019, -0.4141780138015747, 0.2005191147327423}, {0.48409703373908997, -0.4141780138015747, -0.2005201131105423}, {0.0, -0.4141780436038971, -0.5239831805229187}, {0.0, -0.4141779839992523, 0.5239825248718262}, {-0.3705122172832489, -0.4141780436038971, -0.37051162123680115}, {0.20051926374435425, -0.4141780436038971, -0.48409754037857056}, {-0.2005194127559662, -0.4141779839992523, 0.4840966761112213}, {0.5239830017089844, -0.4141780138015747, -5.190973979551927e-07}, {-0.5239827632904053, -0.4141780138015747, -3.025546391199896e-07}, {-0.20051999390125275, -0.4141780436038971, -0.48409706354141235}, {0.2005195915699005, -0.4141779839992523, 0.4840966761112213}, {0.3705116808414459, -0.4141780436038971, -0.370512455701828}, {-0.3705116808414459, -0.4141779839992523, 0.37051156163215637}, {-0.4840972423553467, -0.4141780138015747, -0.20051917433738708}};
 const unsigned short faces2[556][4] = {{2, 8, 7, 1}, {3, 9, 8, 2}, {4, 10, 9, 3}, {5, 11, 10, 4}, {17, 11, 6, 12}, {6, 0, 1, 7}, {7, 13, 12, 6}, {8, 14, 13, 7}, {9, 15, 14, 8}, {10, 16, 15, 9}, {11, 17, 16, 10}, {19, 25, 24, 18}, {14, 20, 19, 13}, {15, 21, 20, 14}, {16, 22, 21, 15}, {17, 23, 22, 16}, {23, 17, 12, 18}, {25, 31, 30, 24}, {20, 26, 25, 19}, {21, 27, 26, 20}, {22, 28, 27, 21}, {23, 29, 28, 22}, {29, 23, 18, 24}, {31, 37, 36, 30}, {26, 32, 31, 25}, {27, 33, 32, 26}, {28, 34, 33, 27}, {29, 35, 34, 28}, {35, 29, 24, 30}, {37, 43, 42, 36}, {32, 38, 37, 31}, {33, 39, 38, 32}, {34, 40, 39, 33}, {35, 41, 40, 34}, {41, 35, 30, 36}, {38, 44, 43, 37}, {39, 45, 44, 38}, {40, 46, 45, 39}, {41, 47, 46, 40}, {47, 41, 36, 42}, {13, 19, 18, 12}, {0, 6, 11, 5}, {46, 47, 53, 52}, {45, 46, 52, 51}, {44, 45, 51, 50}, {43, 44, 50, 49}, {42, 43, 49, 48}, {47, 42, 48, 53}, {52, 53, 59, 58}, {50, 51, 57, 56}, {48, 49, 55, 54}, {53, 48, 54, 59}, {51, 52, 58, 57}, {49, 50, 56, 55}, {75, 129, 125, 79}, {121, 83, 79, 125}, {83, 121, 117, 87}, {393, 363, 87, 117}, {363, 393, 113, 91}, {91, 113, 109, 95}, {105, 99, 95, 109}, {99, 105, 101, 103}, {97, 107, 103, 101}, {107, 97, 93, 111}, {111, 93, 89, 115}, {115, 89, 361, 395}, {395, 361, 85, 119}, {119, 85, 81, 123}, {123, 81, 77, 127}, {62, 61, 200, 202}, {127, 77, 129, 75}, {128, 127, 75, 74}, {105, 98, 102, 101}, {120, 152, 434, 396}, {112, 116, 150, 148}, {261, 267, 149, 151}, {104, 103, 107, 108}, {124, 123, 127, 128}, {81, 122, 126, 77}, {269, 198, 196, 260}, {61, 62, 82, 78}, {92, 96, 140, 138}, {120, 119, 123, 124}, {264, 269, 157, 130}, {84, 134, 132, 80}, {71, 342, 502, 211}, {92, 91, 95, 96}, {257, 182, 180, 266}, {396, 395, 119, 120}, {361, 394, 118, 85}, {129, 76, 78, 125}, {120, 124, 154, 152}, {88, 87, 363, 364}, {559, 466, 178, 262}, {116, 115, 395, 396}, {74, 80, 132, 131}, {558, 261, 151, 435}, {334, 64, 90, 362}, {262, 268, 135, 137}, {112, 111, 115, 116}, {256, 174, 199, 264}, {92, 138, 418, 364}, {128, 74, 131, 156}, {74, 75, 79, 80}, {104, 108, 146, 144}, {108, 107, 111, 112}, {67, 68, 106, 102}, {258, 257, 141, 143}, {364, 418, 136, 88}, {68, 69, 110, 106}, {66, 67, 102, 98}, {393, 362, 90, 113}, {100, 99, 103, 104}, {256, 133, 135, 268}, {109, 94, 98, 105}, {77, 126, 76, 129}, {96, 95, 99, 100}, {72, 73, 126, 122}, {112, 148, 146, 108}, {100, 142, 140, 96}, {65, 66, 98, 94}, {85, 118, 122, 81}, {342, 71, 118, 394}, {364, 363, 91, 92}, {101, 102, 106, 97}, {117, 86, 362, 393}, {70, 342, 394, 114}, {80, 79, 83, 84}, {396, 434, 150, 116}, {64, 65, 94, 90}, {267, 259, 147, 149}, {84, 83, 87, 88}, {128, 156, 154, 124}, {125, 78, 82, 121}, {84, 88, 136, 134}, {62, 63, 86, 82}, {63, 334, 362, 86}, {73, 60, 76, 126}, {97, 106, 110, 93}, {71, 72, 122, 118}, {263, 258, 143, 145}, {242, 131, 132, 243}, {259, 263, 145, 147}, {255, 156, 131, 242}, {254, 154, 156, 255}, {253, 152, 154, 254}, {550, 434, 152, 253}, {252, 150, 434, 550}, {251, 148, 150, 252}, {250, 146, 148, 251}, {249, 144, 146, 250}, {248, 142, 144, 249}, {247, 140, 142, 248}, {246, 138, 140, 247}, {542, 418, 138, 246}, {245, 136, 418, 542}, {244, 134, 136, 245}, {243, 132, 134, 244}, {265, 558, 435, 153}, {121, 82, 86, 117}, {266, 559, 419, 139}, {93, 110, 114, 89}, {100, 104, 144, 142}, {113, 90, 94, 109}, {69, 70, 114, 110}, {89, 114, 394, 361}, {170, 169, 225, 226}, {64, 204, 205, 65}, {70, 69, 209, 210}, {72, 212, 213, 73}, {63, 203, 494, 334}, {68, 67, 207, 208}, {66, 65, 205, 206}, {60, 73, 213, 201}, {64, 334, 494, 204}, {72, 71, 211, 212}, {63, 62, 202, 203}, {342, 70, 210, 502}, {61, 60, 201, 200}, {69, 68, 208, 209}, {67, 66, 206, 207}, {172, 199, 174, 173}, {260, 265, 153, 155}, {197, 198, 199, 172}, {195, 196, 198, 197}, {193, 194, 196, 195}, {481, 482, 194, 193}, {191, 192, 482, 481}, {189, 190, 192, 191}, {187, 188, 190, 189}, {185, 186, 188, 187}, {183, 184, 186, 185}, {181, 182, 184, 183}, {179, 180, 182, 181}, {465, 466, 180, 179}, {177, 178, 466, 465}, {175, 176, 178, 177}, {173, 174, 176, 175}, {60, 61, 78, 76}, {228, 229, 200, 201}, {229, 230, 202, 200}, {230, 231, 203, 202}, {231, 526, 494, 203}, {526, 232, 204, 494}, {232, 233, 205, 204}, {233, 234, 206, 205}, {234, 235, 207, 206}, {235, 236, 208, 207}, {236, 237, 209, 208}, {237, 238, 210, 209}, {238, 534, 502, 210}, {534, 239, 211, 502}, {239, 240, 212, 211}, {240, 241, 213, 212}, {241, 228, 201, 213}, {164, 163, 219, 220}, {171, 170, 226, 227}, {165, 164, 220, 221}, {159, 158, 215, 214}, {158, 171, 227, 215}, {166, 165, 221, 222}, {160, 159, 214, 216}, {167, 166, 222, 223}, {161, 160, 216, 217}, {168, 167, 223, 224}, {446, 161, 217, 510}, {454, 168, 224, 518}, {162, 446, 510, 218}, {169, 454, 518, 225}, {163, 162, 218, 219}, {171, 158, 228, 241}, {170, 171, 241, 240}, {169, 170, 240, 239}, {454, 169, 239, 534}, {168, 454, 534, 238}, {167, 168, 238, 237}, {166, 167, 237, 236}, {165, 166, 236, 235}, {164, 165, 235, 234}, {163, 164, 234, 233}, {162, 163, 233, 232}, {446, 162, 232, 526}, {161, 446, 526, 231}, {160, 161, 231, 230}, {159, 160, 230, 229}, {158, 159, 229, 228}, {133, 243, 244, 135}, {135, 244, 245, 137}, {137, 245, 542, 419}, {419, 542, 246, 139}, {139, 246, 247, 141}, {141, 247, 248, 143}, {143, 248, 249, 145}, {145, 249, 250, 147}, {147, 250, 251, 149}, {149, 251, 252, 151}, {151, 252, 550, 435}, {435, 550, 253, 153}, {153, 253, 254, 155}, {155, 254, 255, 157}, {157, 255, 242, 130}, {130, 242, 243, 133}, {196, 194, 265, 260}, {180, 466, 559, 266}, {194, 482, 558, 265}, {188, 186, 263, 259}, {186, 184, 258, 263}, {190, 188, 259, 267}, {174, 256, 268, 176}, {184, 182, 257, 258}, {133, 256, 264, 130}, {178, 176, 268, 262}, {482, 192, 261, 558}, {419, 559, 262, 137}, {141, 257, 266, 139}, {199, 198, 269, 264}, {157, 269, 260, 155}, {192, 190, 267, 261}, {272, 271, 277, 278}, {273, 272, 278, 279}, {274, 273, 279, 280}, {275, 274, 280, 281}, {287, 282, 276, 281}, {276, 277, 271, 270}, {277, 276, 282, 283}, {278, 277, 283, 284}, {279, 278, 284, 285}, {280, 279, 285, 286}, {281, 280, 286, 287}, {289, 288, 294, 295}, {284, 283, 289, 290}, {285, 284, 290, 291}, {286, 285, 291, 292}, {287, 286, 292, 293}, {293, 288, 282, 287}, {295, 294, 300, 301}, {290, 289, 295, 296}, {291, 290, 296, 297}, {292, 291, 297, 298}, {293, 292, 298, 299}, {299, 294, 288, 293}, {301, 300, 306, 307}, {296, 295, 301, 302}, {297, 296, 302, 303}, {298, 297, 303, 304}, {299, 298, 304, 305}, {305, 300, 294, 299}, {307, 306, 312, 313}, {302, 301, 307, 308}, {303, 302, 308, 309}, {304, 303, 309, 310}, {305, 304, 310, 311}, {311, 306, 300, 305}, {308, 307, 313, 314}, {309, 308, 314, 315}, {310, 309, 315, 316}, {311, 310, 316, 317}, {317, 312, 306, 311}, {283, 282, 288, 289}, {270, 275, 281, 276}, {316, 322, 323, 317}, {315, 321, 322, 316}, {314, 320, 321, 315}, {313, 319, 320, 314}, {312, 318, 319, 313}, {317, 323, 318, 312}, {322, 328, 329, 323}, {320, 326, 327, 321}, {318, 324, 325, 319}, {323, 329, 324, 318}, {321, 327, 328, 322}, {319, 325, 326, 320}, {347, 351, 405, 409}, {401, 405, 351, 355}, {355, 359, 397, 401}, {393, 397, 359, 363}, {363, 367, 389, 393}, {367, 371, 385, 389}, {381, 385, 371, 375}, {375, 379, 377, 381}, {373, 377, 379, 383}, {383, 387, 369, 373}, {387, 391, 365, 369}, {391, 395, 361, 365}, {395, 399, 357, 361}, {399, 403, 353, 357}, {403, 407, 349, 353}, {332, 492, 490, 331}, {407, 347, 409, 349}, {408, 346, 347, 407}, {381, 377, 378, 374}, {400, 396, 434, 436}, {388, 430, 432, 392}, {561, 433, 431, 567}, {380, 384, 383, 379}, {404, 408, 407, 403}, {353, 349, 406, 402}, {569, 560, 486, 488}, {331, 350, 354, 332}, {368, 420, 422, 372}, {400, 404, 403, 399}, {564, 410, 441, 569}, {356, 352, 412, 414}, {343, 503, 502, 342}, {368, 372, 371, 367}, {555, 566, 468, 470}, {396, 400, 399, 395}, {361, 357, 398, 394}, {409, 405, 350, 348}, {400, 436, 438, 404}, {360, 364, 363, 359}, {559, 562, 464, 466}, {392, 396, 395, 391}, {346, 411, 412, 352}, {558, 435, 433, 561}, {334, 362, 366, 335}, {562, 417, 415, 568}, {388, 392, 391, 387}, {554, 564, 489, 460}, {368, 364, 418, 420}, {408, 440, 411, 346}, {346, 352, 351, 347}, {380, 426, 428, 384}, {384, 388, 387, 383}, {338, 378, 382, 339}, {556, 425, 423, 555}, {364, 360, 416, 418}, {339, 382, 386, 340}, {337, 374, 378, 338}, {393, 389, 366, 362}, {376, 380, 379, 375}, {554, 568, 415, 413}, {385, 381, 374, 370}, {349, 409, 348, 406}, {372, 376, 375, 371}, {344, 402, 406, 345}, {388, 384, 428, 430}, {376, 372, 422, 424}, {336, 370, 374, 337}, {357, 353, 402, 398}, {342, 394, 398, 343}, {364, 368, 367, 363}, {377, 373, 382, 378}, {397, 393, 362, 358}, {341, 390, 394, 342}, {352, 356, 355, 351}, {396, 392, 432, 434}, {335, 366, 370, 336}, {567, 431, 429, 557}, {356, 360, 359, 355}, {408, 404, 438, 440}, {405, 401, 354, 350}, {356, 414, 416, 360}, {332, 354, 358, 333}, {333, 358, 362, 334}, {345, 406, 348, 330}, {373, 369, 386, 382}, {343, 398, 402, 344}, {563, 427, 425, 556}, {538, 539, 412, 411}, {557, 429, 427, 563}, {553, 538, 411, 440}, {552, 553, 440, 438}, {551, 552, 438, 436}, {550, 551, 436, 434}, {549, 550, 434, 432}, {548, 549, 432, 430}, {547, 548, 430, 428}, {546, 547, 428, 426}, {545, 546, 426, 424}, {544, 545, 424, 422}, {543, 544, 422, 420}, {542, 543, 420, 418}, {541, 542, 418, 416}, {540, 541, 416, 414}, {539, 540, 414, 412}, {565, 437, 435, 558}, {401, 397, 358, 354}, {566, 421, 419, 559}, {369, 365, 390, 386}, {376, 424, 426, 380}, {389, 385, 370, 366}, {340, 386, 390, 341}, {365, 361, 394, 390}, {456, 520, 519, 455}, {335, 336, 496, 495}, {341, 501, 500, 340}, {344, 345, 505, 504}, {333, 334, 494, 493}, {339, 499, 498, 338}, {337, 497, 496, 336}, {330, 491, 505, 345}, {335, 495, 494, 334}, {344, 504, 503, 343}, {333, 493, 492, 332}, {342, 502, 501, 341}, {331, 490, 491, 330}, {340, 500, 499, 339}, {338, 498, 497, 337}, {458, 459, 460, 489}, {560, 439, 437, 565}, {487, 458, 489, 488}, {485, 487, 488, 486}, {483, 485, 486, 484}, {481, 483, 484, 482}, {479, 481, 482, 480}, {477, 479, 480, 478}, {475, 477, 478, 476}, {473, 475, 476, 474}, {471, 473, 474, 472}, {469, 471, 472, 470}, {467, 469, 470, 468}, {465, 467, 468, 466}, {463, 465, 466, 464}, {461, 463, 464, 462}, {459, 461, 462, 460}, {330, 348, 350, 331}, {522, 491, 490, 523}, {523, 490, 492, 524}, {524, 492, 493, 525}, {525, 493, 494, 526}, {526, 494, 495, 527}, {527, 495, 496, 528}, {528, 496, 497, 529}, {529, 497, 498, 530}, {530, 498, 499, 531}, {531, 499, 500, 532}, {532, 500, 501, 533}, {533, 501, 502, 534}, {534, 502, 503, 535}, {535, 503, 504, 536}, {536, 504, 505, 537}, {537, 505, 491, 522}, {449, 513, 512, 448}, {457, 521, 520, 456}, {450, 514, 513, 449}, {443, 506, 507, 442}, {442, 507, 521, 457}, {451, 515, 514, 450}, {444, 508, 506, 443}, {452, 516, 515, 451}, {445, 509, 508, 444}, {453, 517, 516, 452}, {446, 510, 509, 445}, {454, 518, 517, 453}, {447, 511, 510, 446}, {455, 519, 518, 454}, {448, 512, 511, 447}, {457, 537, 522, 442}, {456, 536, 537, 457}, {455, 535, 536, 456}, {454, 534, 535, 455}, {453, 533, 534, 454}, {452, 532, 533, 453}, {451, 531, 532, 452}, {450, 530, 531, 451}, {449, 529, 530, 450}, {448, 528, 529, 449}, {447, 527, 528, 448}, {446, 526, 527, 447}, {445, 525, 526, 446}, {444, 524, 525, 445}, {443, 523, 524, 444}, {442, 522, 523, 443}, {413, 415, 540, 539}, {415, 417, 541, 540}, {417, 419, 542, 541}, {419, 421, 543, 542}, {421, 423, 544, 543}, {423, 425, 545, 544}, {425, 427, 546, 545}, {427, 429, 547, 546}, {429, 431, 548, 547}, {431, 433, 549, 548}, {433, 435, 550, 549}, {435, 437, 551, 550}, {437, 439, 552, 551}, {439, 441, 553, 552}, {441, 410, 538, 553}, {410, 413, 539, 538}, {486, 560, 565, 484}, {468, 566, 559, 466}, {484, 565, 558, 482}, {476, 557, 563, 474}, {474, 563, 556, 472}, {478, 567, 557, 476}, {460, 462, 568, 554}, {472, 556, 555, 470}, {413, 410, 564, 554}, {464, 562, 568, 462}, {482, 558, 561, 480}, {419, 417, 562, 559}, {423, 421, 566, 555}, {489, 564, 569, 488}, {441, 439, 560, 569}, {480, 561, 567, 478}};
 
-ObjData trophy_object = {verts2, faces2[0], 556};
+ObjData trophy_object = {verts2, 570, faces2[0], 556, 2.168};
 
-const Vector3 verts4[200] = {{1.25, 0.0, 0.0}, {1.202254295349121, 0.0, 0.14694631099700928}, {1.077254295349121, 0.0, 0.2377641350030899}, {0.9227457642555237, 0.0, 0.2377641350030899}, {0.7977457642555237, 0.0, 0.14694631099700928}, {0.75, 0.0, 3.0616171314629196e-17}, {0.7977457642555237, 0.0, -0.14694631099700928}, {0.9227457642555237, 0.0, -0.2377641350030899}, {1.077254295349121, 0.0, -0.2377641350030899}, {1.202254295349121, 0.0, -0.14694631099700928}, {1.188820719718933, 0.3862711191177368, 0.0}, {1.1434117555618286, 0.3715168833732605, 0.14694631099700928}, {1.0245296955108643, 0.33288976550102234, 0.2377641350030899}, {0.877583384513855, 0.28514403104782104, 0.2377641350030899}, {0.7587013244628906, 0.24651691317558289, 0.14694631099700928}, {0.7132924199104309, 0.23176266252994537, 3.0616171314629196e-17}, {0.7587013244628906, 0.24651691317558289, -0.14694631099700928}, {0.877583384513855, 0.28514403104782104, -0.2377641350030899}, {1.0245296955108643, 0.33288976550102234, -0.2377641350030899}, {1.1434117555618286, 0.3715168833732605, -0.14694631099700928}, {1.0112712383270264, 0.7347315549850464, 0.0}, {0.9726441502571106, 0.7066673636436462, 0.14694631099700928}, {0.8715170621871948, 0.6331942081451416, 0.2377641350030899}, {0.74651700258255, 0.5423763394355774, 0.2377641350030899}, {0.6453899145126343, 0.46890318393707275, 0.14694631099700928}, {0.6067627668380737, 0.44083893299102783, 3.0616171314629196e-17}, {0.6453899145126343, 0.46890318393707275, -0.14694631099700928}, {0.74651700258255, 0.5423763394355774, -0.2377641350030899}, {0.8715170621871948, 0.6331942081451416, -0.2377641350030899}, {0.9726441502571106, 0.7066673636436462, -0.14694631099700928}, {0.7347314357757568, 1.011271357536316, 0.0}, {0.7066671848297119, 0.9726442098617554, 0.14694631099700928}, {0.6331940293312073, 0.8715171217918396, 0.2377641350030899}, {0.5423762202262878, 0.7465170621871948, 0.2377641350030899}, {0.4689030945301056, 0.6453899145126343, 0.14694631099700928}, {0.44083884358406067, 0.6067627668380737, 3.0616171314629196e-17}, {0.4689030945301056, 0.6453899145126343, -0.14694631099700928}, {0.5423762202262878, 0.7465170621871948, -0.2377641350030899}, {0.6331940293312073, 0.8715171217918396, -0.2377641350030899}, {0.7066671848297119, 0.9726442098617554, -0.14694631099700928}, {0.38627147674560547, 1.1888206005096436, 0.0}, {0.37151724100112915, 1.1434117555618286, 0.14694631099700928}, {0.3328900933265686, 1.0245296955108643, 0.2377641350030899}, {0.28514429926872253, 0.8775833249092102, 0.2377641350030899}, {0.246517151594162, 0.7587012648582458, 0.14694631099700928}, {0.23176288604736328, 0.7132923603057861, 3.0616171314629196e-17}, {0.246517151594162, 0.7587012648582458, -0.14694631099700928}, {0.28514429926872253, 0.8775833249092102, -0.2377641350030899}, {0.3328900933265686, 1.0245296955108643, -0.2377641350030899}, {0.37151724100112915, 1.1434117555618286, -0.14694631099700928}, {9.437237480369731e-08, 1.25, 0.0}, {9.07676778183486e-08, 1.202254295349121, 0.14694631099700928}, {8.133044104852161e-08, 1.077254295349121, 0.2377641350030899}, {6.966536858499239e-08, 0.9227457642555237, 0.2377641350030899}, {6.02281318151654e-08, 0.7977457642555237, 0.14694631099700928}, {5.662342772438933e-08, 0.75, 3.0616171314629196e-17}, {6.02281318151654e-08, 0.7977457642555237, -0.14694631099700928}, {6.966536858499239e-08, 0.9227457642555237, -0.2377641350030899}, {8.133044104852161e-08, 1.077254295349121, -0.2377641350030899}, {9.07676778183486e-08, 1.202254295349121, -0.14694631099700928}, {-0.38627129793167114, 1.1888206005096436, 0.0}, {-0.3715170621871948, 1.1434117555618286, 0.14694631099700928}, {-0.3328899145126343, 1.0245296955108643, 0.2377641350030899}, {-0.2851441502571106, 0.8775833249092102, 0.2377641350030899}, {-0.24651703238487244, 0.7587012648582458, 0.14694631099700928}, {-0.23176276683807373, 0.7132923603057861, 3.0616171314629196e-17}, {-0.24651703238487244, 0.7587012648582458, -0.14694631099700928}, {-0.2851441502571106, 0.8775833249092102, -0.2377641350030899}, {-0.3328899145126343, 1.0245296955108643, -0.2377641350030899}, {-0.3715170621871948, 1.1434117555618286, -0.14694631099700928}, {-0.7347317934036255, 1.0112711191177368, 0.0}, {-0.7066675424575806, 0.972644031047821, 0.14694631099700928}, {-0.6331943869590759, 0.8715168833732605, 0.2377641350030899}, {-0.5423765182495117, 0.7465168833732605, 0.2377641350030899}, {-0.4689033329486847, 0.6453897953033447, 0.14694631099700928}, {-0.4408390522003174, 0.6067626476287842, 3.0616171314629196e-17}, {-0.4689033329486847, 0.6453897953033447, -0.14694631099700928}, {-0.5423765182495117, 0.7465168833732605, -0.2377641350030899}, {-0.6331943869590759, 0.8715168833732605, -0.2377641350030899}, {-0.7066675424575806, 0.972644031047821, -0.14694631099700928}, {-1.0112714767456055, 0.7347312569618225, 0.0}, {-0.9726443886756897, 0.7066670656204224, 0.14694631099700928}, {-0.8715172410011292, 0.6331939101219177, 0.2377641350030899}, {-0.7465171813964844, 0.5423761010169983, 0.2377641350030899}, {-0.6453900337219238, 0.4689030051231384, 0.14694631099700928}, {-0.6067628860473633, 0.4408387541770935, 3.0616171314629196e-17}, {-0.6453900337219238, 0.4689030051231384, -0.14694631099700928}, {-0.7465171813964844, 0.5423761010169983, -0.2377641350030899}, {-0.8715172410011292, 0.6331939101219177, -0.2377641350030899}, {-0.9726443886756897, 0.7066670656204224, -0.14694631099700928}, {-1.1888206005096436, 0.38627129793167114, 0.0}, {-1.1434117555618286, 0.3715170621871948, 0.14694631099700928}, {-1.0245296955108643, 0.3328899145126343, 0.2377641350030899}, {-0.8775833249092102, 0.2851441502571106, 0.2377641350030899}, {-0.7587012648582458, 0.24651703238487244, 0.14694631099700928}, {-0.7132923603057861, 0.23176276683807373, 3.0616171314629196e-17}, {-0.7587012648582458, 0.24651703238487244, -0.14694631099700928}, {-0.8775833249092102, 0.2851441502571106, -0.2377641350030899}, {-1.0245296955108643, 0.3328899145126343, -0.2377641350030899}, {-1.1434117555618286, 0.3715170621871948, -0.14694631099700928}, {-1.25, 1.092784742695585e-07, 0.0}, {-1.202254295349121, 1.0510440517919051e-07, 0.14694631099700928}, {-1.077254295349121, 9.417656343657654e-08, 0.2377641350030899}, {-0.9227457642555237, 8.066899681580253e-08, 0.2377641350030899}, {-0.7977457642555237, 6.974114796776121e-08, 0.14694631099700928}, {-0.75, 6.556707887739321e-08, 3.0616171314629196e-17}, {-0.7977457642555237, 6.974114796776121e-08, -0.14694631099700928}, {-0.9227457642555237, 8.066899681580253e-08, -0.2377641350030899}, {-1.077254295349121, 9.417656343657654e-08, -0.2377641350030899}, {-1.202254295349121, 1.0510440517919051e-07, -0.14694631099700928}, {-1.1888208389282227, -0.3862707316875458, 0.0}, {-1.1434119939804077, -0.37151652574539185, 0.14694631099700928}, {-1.0245298147201538, -0.3328894376754761, 0.2377641350030899}, {-0.8775835037231445, -0.28514373302459717, 0.2377641350030899}, {-0.7587014436721802, -0.24651667475700378, 0.14694631099700928}, {-0.7132924795150757, -0.23176243901252747, 3.0616171314629196e-17}, {-0.7587014436721802, -0.24651667475700378, -0.14694631099700928}, {-0.8775835037231445, -0.28514373302459717, -0.2377641350030899}, {-1.0245298147201538, -0.3328894376754761, -0.2377641350030899}, {-1.1434119939804077, -0.37151652574539185, -0.14694631099700928}, {-1.0112714767456055, -0.7347312569618225, 0.0}, {-0.9726443886756897, -0.7066670656204224, 0.14694631099700928}, {-0.8715172410011292, -0.6331939101219177, 0.2377641350030899}, {-0.7465171813964844, -0.5423761010169983, 0.2377641350030899}, {-0.6453900337219238, -0.4689030051231384, 0.14694631099700928}, {-0.6067628860473633, -0.4408387541770935, 3.0616171314629196e-17}, {-0.6453900337219238, -0.4689030051231384, -0.14694631099700928}, {-0.7465171813964844, -0.5423761010169983, -0.2377641350030899}, {-0.8715172410011292, -0.6331939101219177, -0.2377641350030899}, {-0.9726443886756897, -0.7066670656204224, -0.14694631099700928}, {-0.7347317934036255, -1.0112711191177368, 0.0}, {-0.7066675424575806, -0.972644031047821, 0.14694631099700928}, {-0.6331943869590759, -0.8715168833732605, 0.2377641350030899}, {-0.5423765182495117, -0.7465168833732605, 0.2377641350030899}, {-0.4689033329486847, -0.6453897953033447, 0.14694631099700928}, {-0.4408390522003174, -0.6067626476287842, 3.0616171314629196e-17}, {-0.4689033329486847, -0.6453897953033447, -0.14694631099700928}, {-0.5423765182495117, -0.7465168833732605, -0.2377641350030899}, {-0.6331943869590759, -0.8715168833732605, -0.2377641350030899}, {-0.7066675424575806, -0.972644031047821, -0.14694631099700928}, {-0.38627129793167114, -1.1888206005096436, 0.0}, {-0.3715170621871948, -1.1434117555618286, 0.14694631099700928}, {-0.3328899145126343, -1.0245296955108643, 0.2377641350030899}, {-0.2851441502571106, -0.8775833249092102, 0.2377641350030899}, {-0.24651703238487244, -0.7587012648582458, 0.14694631099700928}, {-0.23176276683807373, -0.7132923603057861, 3.0616171314629196e-17}, {-0.24651703238487244, -0.7587012648582458, -0.14694631099700928}, {-0.2851441502571106, -0.8775833249092102, -0.2377641350030899}, {-0.3328899145126343, -1.0245296955108643, -0.2377641350030899}, {-0.3715170621871948, -1.1434117555618286, -0.14694631099700928}, {9.437237480369731e-08, -1.25, 0.0}, {9.07676778183486e-08, -1.202254295349121, 0.14694631099700928}, {8.133044104852161e-08, -1.077254295349121, 0.2377641350030899}, {6.966536858499239e-08, -0.9227457642555237, 0.2377641350030899}, {6.02281318151654e-08, -0.7977457642555237, 0.14694631099700928}, {5.662342772438933e-08, -0.75, 3.0616171314629196e-17}, {6.02281318151654e-08, -0.7977457642555237, -0.14694631099700928}, {6.966536858499239e-08, -0.9227457642555237, -0.2377641350030899}, {8.133044104852161e-08, -1.077254295349121, -0.2377641350030899}, {9.07676778183486e-08, -1.202254295349121, -0.14694631099700928}, {0.38627147674560547, -1.1888206005096436, 0.0}, {0.37151724100112915, -1.1434117555618286, 0.14694631099700928}, {0.3328900933265686, -1.0245296955108643, 0.2377641350030899}, {0.28514429926872253, -0.8775833249092102, 0.2377641350030899}, {0.246517151594162, -0.7587012648582458, 0.14694631099700928}, {0.23176288604736328, -0.7132923603057861, 3.0616171314629196e-17}, {0.246517151594162, -0.7587012648582458, -0.14694631099700928}, {0.28514429926872253, -0.8775833249092102, -0.2377641350030899}, {0.3328900933265686, -1.0245296955108643, -0.2377641350030899}, {0.37151724100112915, -1.1434117555618286, -0.14694631099700928}, {0.7347309589385986, -1.0112717151641846, 0.0}, {0.7066667675971985, -0.972644567489624, 0.14694631099700928}, {0.6331936717033386, -0.8715174198150635, 0.2377641350030899}, {0.542375922203064, -0.7465173602104187, 0.2377641350030899}, {0.4689027965068817, -0.6453901529312134, 0.14694631099700928}, {0.4408385753631592, -0.6067630052566528, 3.0616171314629196e-17}, {0.4689027965068817, -0.6453901529312134, -0.14694631099700928}, {0.542375922203064, -0.7465173602104187, -0.2377641350030899}, {0.6331936717033386, -0.8715174198150635, -0.2377641350030899}, {0.7066667675971985, -0.972644567489624, -0.14694631099700928}, {1.0112708806991577, -0.7347320914268494, 0.0}, {0.9726437926292419, -0.7066678404808044, 0.14694631099700928}, {0.8715167045593262, -0.633194625377655, 0.2377641350030899}, {0.746516764163971, -0.5423767566680908, 0.2377641350030899}, {0.6453896760940552, -0.468903511762619, 0.14694631099700928}, {0.6067625284194946, -0.4408392310142517, 3.0616171314629196e-17}, {0.6453896760940552, -0.468903511762619, -0.14694631099700928}, {0.746516764163971, -0.5423767566680908, -0.2377641350030899}, {0.8715167045593262, -0.633194625377655, -0.2377641350030899}, {0.9726437926292419, -0.7066678404808044, -0.14694631099700928}, {1.188820481300354, -0.3862716555595398, 0.0}, {1.143411636352539, -0.3715174198150635, 0.14694631099700928}, {1.0245295763015747, -0.33289024233818054, 0.2377641350030899}, {0.8775832653045654, -0.2851444184780121, 0.2377641350030899}, {0.7587012052536011, -0.24651727080345154, 0.14694631099700928}, {0.7132923007011414, -0.23176300525665283, 3.0616171314629196e-17}, {0.7587012052536011, -0.24651727080345154, -0.14694631099700928}, {0.8775832653045654, -0.2851444184780121, -0.2377641350030899}, {1.0245295763015747, -0.33289024233818054, -0.2377641350030899}, {1.143411636352539, -0.3715174198150635, -0.14694631099700928}};
+const Vertex verts4[200] = {{1.25, 0.0, 0.0}, {1.202254295349121, 0.0, 0.14694631099700928}, {1.077254295349121, 0.0, 0.2377641350030899}, {0.9227457642555237, 0.0, 0.2377641350030899}, {0.7977457642555237, 0.0, 0.14694631099700928}, {0.75, 0.0, 3.0616171314629196e-17}, {0.7977457642555237, 0.0, -0.14694631099700928}, {0.9227457642555237, 0.0, -0.2377641350030899}, {1.077254295349121, 0.0, -0.2377641350030899}, {1.202254295349121, 0.0, -0.14694631099700928}, {1.188820719718933, 0.3862711191177368, 0.0}, {1.1434117555618286, 0.3715168833732605, 0.14694631099700928}, {1.0245296955108643, 0.33288976550102234, 0.2377641350030899}, {0.877583384513855, 0.28514403104782104, 0.2377641350030899}, {0.7587013244628906, 0.24651691317558289, 0.14694631099700928}, {0.7132924199104309, 0.23176266252994537, 3.0616171314629196e-17}, {0.7587013244628906, 0.24651691317558289, -0.14694631099700928}, {0.877583384513855, 0.28514403104782104, -0.2377641350030899}, {1.0245296955108643, 0.33288976550102234, -0.2377641350030899}, {1.1434117555618286, 0.3715168833732605, -0.14694631099700928}, {1.0112712383270264, 0.7347315549850464, 0.0}, {0.9726441502571106, 0.7066673636436462, 0.14694631099700928}, {0.8715170621871948, 0.6331942081451416, 0.2377641350030899}, {0.74651700258255, 0.5423763394355774, 0.2377641350030899}, {0.6453899145126343, 0.46890318393707275, 0.14694631099700928}, {0.6067627668380737, 0.44083893299102783, 3.0616171314629196e-17}, {0.6453899145126343, 0.46890318393707275, -0.14694631099700928}, {0.74651700258255, 0.5423763394355774, -0.2377641350030899}, {0.8715170621871948, 0.6331942081451416, -0.2377641350030899}, {0.9726441502571106, 0.7066673636436462, -0.14694631099700928}, {0.7347314357757568, 1.011271357536316, 0.0}, {0.7066671848297119, 0.9726442098617554, 0.14694631099700928}, {0.6331940293312073, 0.8715171217918396, 0.2377641350030899}, {0.5423762202262878, 0.7465170621871948, 0.2377641350030899}, {0.4689030945301056, 0.6453899145126343, 0.14694631099700928}, {0.44083884358406067, 0.6067627668380737, 3.0616171314629196e-17}, {0.4689030945301056, 0.6453899145126343, -0.14694631099700928}, {0.5423762202262878, 0.7465170621871948, -0.2377641350030899}, {0.6331940293312073, 0.8715171217918396, -0.2377641350030899}, {0.7066671848297119, 0.9726442098617554, -0.14694631099700928}, {0.38627147674560547, 1.1888206005096436, 0.0}, {0.37151724100112915, 1.1434117555618286, 0.14694631099700928}, {0.3328900933265686, 1.0245296955108643, 0.2377641350030899}, {0.28514429926872253, 0.8775833249092102, 0.2377641350030899}, {0.246517151594162, 0.7587012648582458, 0.14694631099700928}, {0.23176288604736328, 0.7132923603057861, 3.0616171314629196e-17}, {0.246517151594162, 0.7587012648582458, -0.14694631099700928}, {0.28514429926872253, 0.8775833249092102, -0.2377641350030899}, {0.3328900933265686, 1.0245296955108643, -0.2377641350030899}, {0.37151724100112915, 1.1434117555618286, -0.14694631099700928}, {9.437237480369731e-08, 1.25, 0.0}, {9.07676778183486e-08, 1.202254295349121, 0.14694631099700928}, {8.133044104852161e-08, 1.077254295349121, 0.2377641350030899}, {6.966536858499239e-08, 0.9227457642555237, 0.2377641350030899}, {6.02281318151654e-08, 0.7977457642555237, 0.14694631099700928}, {5.662342772438933e-08, 0.75, 3.0616171314629196e-17}, {6.02281318151654e-08, 0.7977457642555237, -0.14694631099700928}, {6.966536858499239e-08, 0.9227457642555237, -0.2377641350030899}, {8.133044104852161e-08, 1.077254295349121, -0.2377641350030899}, {9.07676778183486e-08, 1.202254295349121, -0.14694631099700928}, {-0.38627129793167114, 1.1888206005096436, 0.0}, {-0.3715170621871948, 1.1434117555618286, 0.14694631099700928}, {-0.3328899145126343, 1.0245296955108643, 0.2377641350030899}, {-0.2851441502571106, 0.8775833249092102, 0.2377641350030899}, {-0.24651703238487244, 0.7587012648582458, 0.14694631099700928}, {-0.23176276683807373, 0.7132923603057861, 3.0616171314629196e-17}, {-0.24651703238487244, 0.7587012648582458, -0.14694631099700928}, {-0.2851441502571106, 0.8775833249092102, -0.2377641350030899}, {-0.3328899145126343, 1.0245296955108643, -0.2377641350030899}, {-0.3715170621871948, 1.1434117555618286, -0.14694631099700928}, {-0.7347317934036255, 1.0112711191177368, 0.0}, {-0.7066675424575806, 0.972644031047821, 0.14694631099700928}, {-0.6331943869590759, 0.8715168833732605, 0.2377641350030899}, {-0.5423765182495117, 0.7465168833732605, 0.2377641350030899}, {-0.4689033329486847, 0.6453897953033447, 0.14694631099700928}, {-0.4408390522003174, 0.6067626476287842, 3.0616171314629196e-17}, {-0.4689033329486847, 0.6453897953033447, -0.14694631099700928}, {-0.5423765182495117, 0.7465168833732605, -0.2377641350030899}, {-0.6331943869590759, 0.8715168833732605, -0.2377641350030899}, {-0.7066675424575806, 0.972644031047821, -0.14694631099700928}, {-1.0112714767456055, 0.7347312569618225, 0.0}, {-0.9726443886756897, 0.7066670656204224, 0.14694631099700928}, {-0.8715172410011292, 0.6331939101219177, 0.2377641350030899}, {-0.7465171813964844, 0.5423761010169983, 0.2377641350030899}, {-0.6453900337219238, 0.4689030051231384, 0.14694631099700928}, {-0.6067628860473633, 0.4408387541770935, 3.0616171314629196e-17}, {-0.6453900337219238, 0.4689030051231384, -0.14694631099700928}, {-0.7465171813964844, 0.5423761010169983, -0.2377641350030899}, {-0.8715172410011292, 0.6331939101219177, -0.2377641350030899}, {-0.9726443886756897, 0.7066670656204224, -0.14694631099700928}, {-1.1888206005096436, 0.38627129793167114, 0.0}, {-1.1434117555618286, 0.3715170621871948, 0.14694631099700928}, {-1.0245296955108643, 0.3328899145126343, 0.2377641350030899}, {-0.8775833249092102, 0.2851441502571106, 0.2377641350030899}, {-0.7587012648582458, 0.24651703238487244, 0.14694631099700928}, {-0.7132923603057861, 0.23176276683807373, 3.0616171314629196e-17}, {-0.7587012648582458, 0.24651703238487244, -0.14694631099700928}, {-0.8775833249092102, 0.2851441502571106, -0.2377641350030899}, {-1.0245296955108643, 0.3328899145126343, -0.2377641350030899}, {-1.1434117555618286, 0.3715170621871948, -0.14694631099700928}, {-1.25, 1.092784742695585e-07, 0.0}, {-1.202254295349121, 1.0510440517919051e-07, 0.14694631099700928}, {-1.077254295349121, 9.417656343657654e-08, 0.2377641350030899}, {-0.9227457642555237, 8.066899681580253e-08, 0.2377641350030899}, {-0.7977457642555237, 6.974114796776121e-08, 0.14694631099700928}, {-0.75, 6.556707887739321e-08, 3.0616171314629196e-17}, {-0.7977457642555237, 6.974114796776121e-08, -0.14694631099700928}, {-0.9227457642555237, 8.066899681580253e-08, -0.2377641350030899}, {-1.077254295349121, 9.417656343657654e-08, -0.2377641350030899}, {-1.202254295349121, 1.0510440517919051e-07, -0.14694631099700928}, {-1.1888208389282227, -0.3862707316875458, 0.0}, {-1.1434119939804077, -0.37151652574539185, 0.14694631099700928}, {-1.0245298147201538, -0.3328894376754761, 0.2377641350030899}, {-0.8775835037231445, -0.28514373302459717, 0.2377641350030899}, {-0.7587014436721802, -0.24651667475700378, 0.14694631099700928}, {-0.7132924795150757, -0.23176243901252747, 3.0616171314629196e-17}, {-0.7587014436721802, -0.24651667475700378, -0.14694631099700928}, {-0.8775835037231445, -0.28514373302459717, -0.2377641350030899}, {-1.0245298147201538, -0.3328894376754761, -0.2377641350030899}, {-1.1434119939804077, -0.37151652574539185, -0.14694631099700928}, {-1.0112714767456055, -0.7347312569618225, 0.0}, {-0.9726443886756897, -0.7066670656204224, 0.14694631099700928}, {-0.8715172410011292, -0.6331939101219177, 0.2377641350030899}, {-0.7465171813964844, -0.5423761010169983, 0.2377641350030899}, {-0.6453900337219238, -0.4689030051231384, 0.14694631099700928}, {-0.6067628860473633, -0.4408387541770935, 3.0616171314629196e-17}, {-0.6453900337219238, -0.4689030051231384, -0.14694631099700928}, {-0.7465171813964844, -0.5423761010169983, -0.2377641350030899}, {-0.8715172410011292, -0.6331939101219177, -0.2377641350030899}, {-0.9726443886756897, -0.7066670656204224, -0.14694631099700928}, {-0.7347317934036255, -1.0112711191177368, 0.0}, {-0.7066675424575806, -0.972644031047821, 0.14694631099700928}, {-0.6331943869590759, -0.8715168833732605, 0.2377641350030899}, {-0.5423765182495117, -0.7465168833732605, 0.2377641350030899}, {-0.4689033329486847, -0.6453897953033447, 0.14694631099700928}, {-0.4408390522003174, -0.6067626476287842, 3.0616171314629196e-17}, {-0.4689033329486847, -0.6453897953033447, -0.14694631099700928}, {-0.5423765182495117, -0.7465168833732605, -0.2377641350030899}, {-0.6331943869590759, -0.8715168833732605, -0.2377641350030899}, {-0.7066675424575806, -0.972644031047821, -0.14694631099700928}, {-0.38627129793167114, -1.1888206005096436, 0.0}, {-0.3715170621871948, -1.1434117555618286, 0.14694631099700928}, {-0.3328899145126343, -1.0245296955108643, 0.2377641350030899}, {-0.2851441502571106, -0.8775833249092102, 0.2377641350030899}, {-0.24651703238487244, -0.7587012648582458, 0.14694631099700928}, {-0.23176276683807373, -0.7132923603057861, 3.0616171314629196e-17}, {-0.24651703238487244, -0.7587012648582458, -0.14694631099700928}, {-0.2851441502571106, -0.8775833249092102, -0.2377641350030899}, {-0.3328899145126343, -1.0245296955108643, -0.2377641350030899}, {-0.3715170621871948, -1.1434117555618286, -0.14694631099700928}, {9.437237480369731e-08, -1.25, 0.0}, {9.07676778183486e-08, -1.202254295349121, 0.14694631099700928}, {8.133044104852161e-08, -1.077254295349121, 0.2377641350030899}, {6.966536858499239e-08, -0.9227457642555237, 0.2377641350030899}, {6.02281318151654e-08, -0.7977457642555237, 0.14694631099700928}, {5.662342772438933e-08, -0.75, 3.0616171314629196e-17}, {6.02281318151654e-08, -0.7977457642555237, -0.14694631099700928}, {6.966536858499239e-08, -0.9227457642555237, -0.2377641350030899}, {8.133044104852161e-08, -1.077254295349121, -0.2377641350030899}, {9.07676778183486e-08, -1.202254295349121, -0.14694631099700928}, {0.38627147674560547, -1.1888206005096436, 0.0}, {0.37151724100112915, -1.1434117555618286, 0.14694631099700928}, {0.3328900933265686, -1.0245296955108643, 0.2377641350030899}, {0.28514429926872253, -0.8775833249092102, 0.2377641350030899}, {0.246517151594162, -0.7587012648582458, 0.14694631099700928}, {0.23176288604736328, -0.7132923603057861, 3.0616171314629196e-17}, {0.246517151594162, -0.7587012648582458, -0.14694631099700928}, {0.28514429926872253, -0.8775833249092102, -0.2377641350030899}, {0.3328900933265686, -1.0245296955108643, -0.2377641350030899}, {0.37151724100112915, -1.1434117555618286, -0.14694631099700928}, {0.7347309589385986, -1.0112717151641846, 0.0}, {0.7066667675971985, -0.972644567489624, 0.14694631099700928}, {0.6331936717033386, -0.8715174198150635, 0.2377641350030899}, {0.542375922203064, -0.7465173602104187, 0.2377641350030899}, {0.4689027965068817, -0.6453901529312134, 0.14694631099700928}, {0.4408385753631592, -0.6067630052566528, 3.0616171314629196e-17}, {0.4689027965068817, -0.6453901529312134, -0.14694631099700928}, {0.542375922203064, -0.7465173602104187, -0.2377641350030899}, {0.6331936717033386, -0.8715174198150635, -0.2377641350030899}, {0.7066667675971985, -0.972644567489624, -0.14694631099700928}, {1.0112708806991577, -0.7347320914268494, 0.0}, {0.9726437926292419, -0.7066678404808044, 0.14694631099700928}, {0.8715167045593262, -0.633194625377655, 0.2377641350030899}, {0.746516764163971, -0.5423767566680908, 0.2377641350030899}, {0.6453896760940552, -0.468903511762619, 0.14694631099700928}, {0.6067625284194946, -0.4408392310142517, 3.0616171314629196e-17}, {0.6453896760940552, -0.468903511762619, -0.14694631099700928}, {0.746516764163971, -0.5423767566680908, -0.2377641350030899}, {0.8715167045593262, -0.633194625377655, -0.2377641350030899}, {0.9726437926292419, -0.7066678404808044, -0.14694631099700928}, {1.188820481300354, -0.3862716555595398, 0.0}, {1.143411636352539, -0.3715174198150635, 0.14694631099700928}, {1.0245295763015747, -0.33289024233818054, 0.2377641350030899}, {0.8775832653045654, -0.2851444184780121, 0.2377641350030899}, {0.7587012052536011, -0.24651727080345154, 0.14694631099700928}, {0.7132923007011414, -0.23176300525665283, 3.0616171314629196e-17}, {0.7587012052536011, -0.24651727080345154, -0.14694631099700928}, {0.8775832653045654, -0.2851444184780121, -0.2377641350030899}, {1.0245295763015747, -0.33289024233818054, -0.2377641350030899}, {1.143411636352539, -0.3715174198150635, -0.14694631099700928}};
 const unsigned short faces4[200][4] = {{0, 10, 11, 1}, {1, 11, 12, 2}, {2, 12, 13, 3}, {3, 13, 14, 4}, {4, 14, 15, 5}, {5, 15, 16, 6}, {6, 16, 17, 7}, {7, 17, 18, 8}, {8, 18, 19, 9}, {9, 19, 10, 0}, {10, 20, 21, 11}, {11, 21, 22, 12}, {12, 22, 23, 13}, {13, 23, 24, 14}, {14, 24, 25, 15}, {15, 25, 26, 16}, {16, 26, 27, 17}, {17, 27, 28, 18}, {18, 28, 29, 19}, {19, 29, 20, 10}, {20, 30, 31, 21}, {21, 31, 32, 22}, {22, 32, 33, 23}, {23, 33, 34, 24}, {24, 34, 35, 25}, {25, 35, 36, 26}, {26, 36, 37, 27}, {27, 37, 38, 28}, {28, 38, 39, 29}, {29, 39, 30, 20}, {30, 40, 41, 31}, {31, 41, 42, 32}, {32, 42, 43, 33}, {33, 43, 44, 34}, {34, 44, 45, 35}, {35, 45, 46, 36}, {36, 46, 47, 37}, {37, 47, 48, 38}, {38, 48, 49, 39}, {39, 49, 40, 30}, {40, 50, 51, 41}, {41, 51, 52, 42}, {42, 52, 53, 43}, {43, 53, 54, 44}, {44, 54, 55, 45}, {45, 55, 56, 46}, {46, 56, 57, 47}, {47, 57, 58, 48}, {48, 58, 59, 49}, {49, 59, 50, 40}, {50, 60, 61, 51}, {51, 61, 62, 52}, {52, 62, 63, 53}, {53, 63, 64, 54}, {54, 64, 65, 55}, {55, 65, 66, 56}, {56, 66, 67, 57}, {57, 67, 68, 58}, {58, 68, 69, 59}, {59, 69, 60, 50}, {60, 70, 71, 61}, {61, 71, 72, 62}, {62, 72, 73, 63}, {63, 73, 74, 64}, {64, 74, 75, 65}, {65, 75, 76, 66}, {66, 76, 77, 67}, {67, 77, 78, 68}, {68, 78, 79, 69}, {69, 79, 70, 60}, {70, 80, 81, 71}, {71, 81, 82, 72}, {72, 82, 83, 73}, {73, 83, 84, 74}, {74, 84, 85, 75}, {75, 85, 86, 76}, {76, 86, 87, 77}, {77, 87, 88, 78}, {78, 88, 89, 79}, {79, 89, 80, 70}, {80, 90, 91, 81}, {81, 91, 92, 82}, {82, 92, 93, 83}, {83, 93, 94, 84}, {84, 94, 95, 85}, {85, 95, 96, 86}, {86, 96, 97, 87}, {87, 97, 98, 88}, {88, 98, 99, 89}, {89, 99, 90, 80}, {90, 100, 101, 91}, {91, 101, 102, 92}, {92, 102, 103, 93}, {93, 103, 104, 94}, {94, 104, 105, 95}, {95, 105, 106, 96}, {96, 106, 107, 97}, {97, 107, 108, 98}, {98, 108, 109, 99}, {99, 109, 100, 90}, {100, 110, 111, 101}, {101, 111, 112, 102}, {102, 112, 113, 103}, {103, 113, 114, 104}, {104, 114, 115, 105}, {105, 115, 116, 106}, {106, 116, 117, 107}, {107, 117, 118, 108}, {108, 118, 119, 109}, {109, 119, 110, 100}, {110, 120, 121, 111}, {111, 121, 122, 112}, {112, 122, 123, 113}, {113, 123, 124, 114}, {114, 124, 125, 115}, {115, 125, 126, 116}, {116, 126, 127, 117}, {117, 127, 128, 118}, {118, 128, 129, 119}, {119, 129, 120, 110}, {120, 130, 131, 121}, {121, 131, 132, 122}, {122, 132, 133, 123}, {123, 133, 134, 124}, {124, 134, 135, 125}, {125, 135, 136, 126}, {126, 136, 137, 127}, {127, 137, 138, 128}, {128, 138, 139, 129}, {129, 139, 130, 120}, {130, 140, 141, 131}, {131, 141, 142, 132}, {132, 142, 143, 133}, {133, 143, 144, 134}, {134, 144, 145, 135}, {135, 145, 146, 136}, {136, 146, 147, 137}, {137, 147, 148, 138}, {138, 148, 149, 139}, {139, 149, 140, 130}, {140, 150, 151, 141}, {141, 151, 152, 142}, {142, 152, 153, 143}, {143, 153, 154, 144}, {144, 154, 155, 145}, {145, 155, 156, 146}, {146, 156, 157, 147}, {147, 157, 158, 148}, {148, 158, 159, 149}, {149, 159, 150, 140}, {150, 160, 161, 151}, {151, 161, 162, 152}, {152, 162, 163, 153}, {153, 163, 164, 154}, {154, 164, 165, 155}, {155, 165, 166, 156}, {156, 166, 167, 157}, {157, 167, 168, 158}, {158, 168, 169, 159}, {159, 169, 160, 150}, {160, 170, 171, 161}, {161, 171, 172, 162}, {162, 172, 173, 163}, {163, 173, 174, 164}, {164, 174, 175, 165}, {165, 175, 176, 166}, {166, 176, 177, 167}, {167, 177, 178, 168}, {168, 178, 179, 169}, {169, 179, 170, 160}, {170, 180, 181, 171}, {171, 181, 182, 172}, {172, 182, 183, 173}, {173, 183, 184, 174}, {174, 184, 185, 175}, {175, 185, 186, 176}, {176, 186, 187, 177}, {177, 187, 188, 178}, {178, 188, 189, 179}, {179, 189, 180, 170}, {180, 190, 191, 181}, {181, 191, 192, 182}, {182, 192, 193, 183}, {183, 193, 194, 184}, {184, 194, 195, 185}, {185, 195, 196, 186}, {186, 196, 197, 187}, {187, 197, 198, 188}, {188, 198, 199, 189}, {189, 199, 190, 180}, {190, 0, 1, 191}, {191, 1, 2, 192}, {192, 2, 3, 193}, {193, 3, 4, 194}, {194, 4, 5, 195}, {195, 5, 6, 196}, {196, 6, 7, 197}, {197, 7, 8, 198}, {198, 8, 9, 199}, {199, 9, 0, 190}};
 
-ObjData torus_object = {verts4, faces4[0], 200};
+ObjData torus_object = {verts4, 200, faces4[0], 200, 1.251};
 
-const Vector3 verts5[507] = {{0.4375, -0.765625, 0.1640625}, {-0.4375, -0.765625, 0.1640625}, {0.5, -0.6875, 0.09375}, {-0.5, -0.6875, 0.09375}, {0.546875, -0.578125, 0.0546875}, {-0.546875, -0.578125, 0.0546875}, {0.3515625, -0.6171875, -0.0234375}, {-0.3515625, -0.6171875, -0.0234375}, {0.3515625, -0.71875, 0.03125}, {-0.3515625, -0.71875, 0.03125}, {0.3515625, -0.78125, 0.1328125}, {-0.3515625, -0.78125, 0.1328125}, {0.2734375, -0.796875, 0.1640625}, {-0.2734375, -0.796875, 0.1640625}, {0.203125, -0.7421875, 0.09375}, {-0.203125, -0.7421875, 0.09375}, {0.15625, -0.6484375, 0.0546875}, {-0.15625, -0.6484375, 0.0546875}, {0.078125, -0.65625, 0.2421875}, {-0.078125, -0.65625, 0.2421875}, {0.140625, -0.7421875, 0.2421875}, {-0.140625, -0.7421875, 0.2421875}, {0.2421875, -0.796875, 0.2421875}, {-0.2421875, -0.796875, 0.2421875}, {0.2734375, -0.796875, 0.328125}, {-0.2734375, -0.796875, 0.328125}, {0.203125, -0.7421875, 0.390625}, {-0.203125, -0.7421875, 0.390625}, {0.15625, -0.6484375, 0.4375}, {-0.15625, -0.6484375, 0.4375}, {0.3515625, -0.6171875, 0.515625}, {-0.3515625, -0.6171875, 0.515625}, {0.3515625, -0.71875, 0.453125}, {-0.3515625, -0.71875, 0.453125}, {0.3515625, -0.78125, 0.359375}, {-0.3515625, -0.78125, 0.359375}, {0.4375, -0.765625, 0.328125}, {-0.4375, -0.765625, 0.328125}, {0.5, -0.6875, 0.390625}, {-0.5, -0.6875, 0.390625}, {0.546875, -0.578125, 0.4375}, {-0.546875, -0.578125, 0.4375}, {0.625, -0.5625, 0.2421875}, {-0.625, -0.5625, 0.2421875}, {0.5625, -0.671875, 0.2421875}, {-0.5625, -0.671875, 0.2421875}, {0.46875, -0.7578125, 0.2421875}, {-0.46875, -0.7578125, 0.2421875}, {0.4765625, -0.7734375, 0.2421875}, {-0.4765625, -0.7734375, 0.2421875}, {0.4453125, -0.78125, 0.3359375}, {-0.4453125, -0.78125, 0.3359375}, {0.3515625, -0.8046875, 0.375}, {-0.3515625, -0.8046875, 0.375}, {0.265625, -0.8203125, 0.3359375}, {-0.265625, -0.8203125, 0.3359375}, {0.2265625, -0.8203125, 0.2421875}, {-0.2265625, -0.8203125, 0.2421875}, {0.265625, -0.8203125, 0.15625}, {-0.265625, -0.8203125, 0.15625}, {0.3515625, -0.828125, 0.2421875}, {-0.3515625, -0.828125, 0.2421875}, {0.3515625, -0.8046875, 0.1171875}, {-0.3515625, -0.8046875, 0.1171875}, {0.4453125, -0.78125, 0.15625}, {-0.4453125, -0.78125, 0.15625}, {0.0, -0.7421875, 0.4296875}, {0.0, -0.8203125, 0.3515625}, {0.0, -0.734375, -0.6796875}, {0.0, -0.78125, -0.3203125}, {0.0, -0.796875, -0.1875}, {0.0, -0.71875, -0.7734375}, {0.0, -0.6015625, 0.40625}, {0.0, -0.5703125, 0.5703125}, {0.0, 0.546875, 0.8984375}, {0.0, 0.8515625, 0.5625}, {0.0, 0.828125, 0.0703125}, {0.0, 0.3515625, -0.3828125}, {0.203125, -0.5625, -0.1875}, {-0.203125, -0.5625, -0.1875}, {0.3125, -0.5703125, -0.4375}, {-0.3125, -0.5703125, -0.4375}, {0.3515625, -0.5703125, -0.6953125}, {-0.3515625, -0.5703125, -0.6953125}, {0.3671875, -0.53125, -0.890625}, {-0.3671875, -0.53125, -0.890625}, {0.328125, -0.5234375, -0.9453125}, {-0.328125, -0.5234375, -0.9453125}, {0.1796875, -0.5546875, -0.96875}, {-0.1796875, -0.5546875, -0.96875}, {0.0, -0.578125, -0.984375}, {0.4375, -0.53125, -0.140625}, {-0.4375, -0.53125, -0.140625}, {0.6328125, -0.5390625, -0.0390625}, {-0.6328125, -0.5390625, -0.0390625}, {0.828125, -0.4453125, 0.1484375}, {-0.828125, -0.4453125, 0.1484375}, {0.859375, -0.59375, 0.4296875}, {-0.859375, -0.59375, 0.4296875}, {0.7109375, -0.625, 0.484375}, {-0.7109375, -0.625, 0.484375}, {0.4921875, -0.6875, 0.6015625}, {-0.4921875, -0.6875, 0.6015625}, {0.3203125, -0.734375, 0.7578125}, {-0.3203125, -0.734375, 0.7578125}, {0.15625, -0.7578125, 0.71875}, {-0.15625, -0.7578125, 0.71875}, {0.0625, -0.75, 0.4921875}, {-0.0625, -0.75, 0.4921875}, {0.1640625, -0.7734375, 0.4140625}, {-0.1640625, -0.7734375, 0.4140625}, {0.125, -0.765625, 0.3046875}, {-0.125, -0.765625, 0.3046875}, {0.203125, -0.7421875, 0.09375}, {-0.203125, -0.7421875, 0.09375}, {0.375, -0.703125, 0.015625}, {-0.375, -0.703125, 0.015625}, {0.4921875, -0.671875, 0.0625}, {-0.4921875, -0.671875, 0.0625}, {0.625, -0.6484375, 0.1875}, {-0.625, -0.6484375, 0.1875}, {0.640625, -0.6484375, 0.296875}, {-0.640625, -0.6484375, 0.296875}, {0.6015625, -0.6640625, 0.375}, {-0.6015625, -0.6640625, 0.375}, {0.4296875, -0.71875, 0.4375}, {-0.4296875, -0.71875, 0.4375}, {0.25, -0.7578125, 0.46875}, {-0.25, -0.7578125, 0.46875}, {0.0, -0.734375, -0.765625}, {0.109375, -0.734375, -0.71875}, {-0.109375, -0.734375, -0.71875}, {0.1171875, -0.7109375, -0.8359375}, {-0.1171875, -0.7109375, -0.8359375}, {0.0625, -0.6953125, -0.8828125}, {-0.0625, -0.6953125, -0.8828125}, {0.0, -0.6875, -0.890625}, {0.0, -0.75, -0.1953125}, {0.0, -0.7421875, -0.140625}, {0.1015625, -0.7421875, -0.1484375}, {-0.1015625, -0.7421875, -0.1484375}, {0.125, -0.75, -0.2265625}, {-0.125, -0.75, -0.2265625}, {0.0859375, -0.7421875, -0.2890625}, {-0.0859375, -0.7421875, -0.2890625}, {0.3984375, -0.671875, -0.046875}, {-0.3984375, -0.671875, -0.046875}, {0.6171875, -0.625, 0.0546875}, {-0.6171875, -0.625, 0.0546875}, {0.7265625, -0.6015625, 0.203125}, {-0.7265625, -0.6015625, 0.203125}, {0.7421875, -0.65625, 0.375}, {-0.7421875, -0.65625, 0.375}, {0.6875, -0.7265625, 0.4140625}, {-0.6875, -0.7265625, 0.4140625}, {0.4375, -0.796875, 0.546875}, {-0.4375, -0.796875, 0.546875}, {0.3125, -0.8359375, 0.640625}, {-0.3125, -0.8359375, 0.640625}, {0.203125, -0.8515625, 0.6171875}, {-0.203125, -0.8515625, 0.6171875}, {0.1015625, -0.84375, 0.4296875}, {-0.1015625, -0.84375, 0.4296875}, {0.125, -0.8125, -0.1015625}, {-0.125, -0.8125, -0.1015625}, {0.2109375, -0.7109375, -0.4453125}, {-0.2109375, -0.7109375, -0.4453125}, {0.25, -0.6875, -0.703125}, {-0.25, -0.6875, -0.703125}, {0.265625, -0.6640625, -0.8203125}, {-0.265625, -0.6640625, -0.8203125}, {0.234375, -0.6328125, -0.9140625}, {-0.234375, -0.6328125, -0.9140625}, {0.1640625, -0.6328125, -0.9296875}, {-0.1640625, -0.6328125, -0.9296875}, {0.0, -0.640625, -0.9453125}, {0.0, -0.7265625, 0.046875}, {0.0, -0.765625, 0.2109375}, {0.328125, -0.7421875, 0.4765625}, {-0.328125, -0.7421875, 0.4765625}, {0.1640625, -0.75, 0.140625}, {-0.1640625, -0.75, 0.140625}, {0.1328125, -0.7578125, 0.2109375}, {-0.1328125, -0.7578125, 0.2109375}, {0.1171875, -0.734375, -0.6875}, {-0.1171875, -0.734375, -0.6875}, {0.078125, -0.75, -0.4453125}, {-0.078125, -0.75, -0.4453125}, {0.0, -0.75, -0.4453125}, {0.0, -0.7421875, -0.328125}, {0.09375, -0.78125, -0.2734375}, {-0.09375, -0.78125, -0.2734375}, {0.1328125, -0.796875, -0.2265625}, {-0.1328125, -0.796875, -0.2265625}, {0.109375, -0.78125, -0.1328125}, {-0.109375, -0.78125, -0.1328125}, {0.0390625, -0.78125, -0.125}, {-0.0390625, -0.78125, -0.125}, {0.0, -0.828125, -0.203125}, {0.046875, -0.8125, -0.1484375}, {-0.046875, -0.8125, -0.1484375}, {0.09375, -0.8125, -0.15625}, {-0.09375, -0.8125, -0.15625}, {0.109375, -0.828125, -0.2265625}, {-0.109375, -0.828125, -0.2265625}, {0.078125, -0.8046875, -0.25}, {-0.078125, -0.8046875, -0.25}, {0.0, -0.8046875, -0.2890625}, {0.2578125, -0.5546875, -0.3125}, {-0.2578125, -0.5546875, -0.3125}, {0.1640625, -0.7109375, -0.2421875}, {-0.1640625, -0.7109375, -0.2421875}, {0.1796875, -0.7109375, -0.3125}, {-0.1796875, -0.7109375, -0.3125}, {0.234375, -0.5546875, -0.25}, {-0.234375, -0.5546875, -0.25}, {0.0, -0.6875, -0.875}, {0.046875, -0.6875, -0.8671875}, {-0.046875, -0.6875, -0.8671875}, {0.09375, -0.7109375, -0.8203125}, {-0.09375, -0.7109375, -0.8203125}, {0.09375, -0.7265625, -0.7421875}, {-0.09375, -0.7265625, -0.7421875}, {0.0, -0.65625, -0.78125}, {0.09375, -0.6640625, -0.75}, {-0.09375, -0.6640625, -0.75}, {0.09375, -0.640625, -0.8125}, {-0.09375, -0.640625, -0.8125}, {0.046875, -0.6328125, -0.8515625}, {-0.046875, -0.6328125, -0.8515625}, {0.0, -0.6328125, -0.859375}, {0.171875, -0.78125, 0.21875}, {-0.171875, -0.78125, 0.21875}, {0.1875, -0.7734375, 0.15625}, {-0.1875, -0.7734375, 0.15625}, {0.3359375, -0.7578125, 0.4296875}, {-0.3359375, -0.7578125, 0.4296875}, {0.2734375, -0.7734375, 0.421875}, {-0.2734375, -0.7734375, 0.421875}, {0.421875, -0.7734375, 0.3984375}, {-0.421875, -0.7734375, 0.3984375}, {0.5625, -0.6953125, 0.3515625}, {-0.5625, -0.6953125, 0.3515625}, {0.5859375, -0.6875, 0.2890625}, {-0.5859375, -0.6875, 0.2890625}, {0.578125, -0.6796875, 0.1953125}, {-0.578125, -0.6796875, 0.1953125}, {0.4765625, -0.71875, 0.1015625}, {-0.4765625, -0.71875, 0.1015625}, {0.375, -0.7421875, 0.0625}, {-0.375, -0.7421875, 0.0625}, {0.2265625, -0.78125, 0.109375}, {-0.2265625, -0.78125, 0.109375}, {0.1796875, -0.78125, 0.296875}, {-0.1796875, -0.78125, 0.296875}, {0.2109375, -0.78125, 0.375}, {-0.2109375, -0.78125, 0.375}, {0.234375, -0.7578125, 0.359375}, {-0.234375, -0.7578125, 0.359375}, {0.1953125, -0.7578125, 0.296875}, {-0.1953125, -0.7578125, 0.296875}, {0.2421875, -0.7578125, 0.125}, {-0.2421875, -0.7578125, 0.125}, {0.375, -0.7265625, 0.0859375}, {-0.375, -0.7265625, 0.0859375}, {0.4609375, -0.703125, 0.1171875}, {-0.4609375, -0.703125, 0.1171875}, {0.546875, -0.671875, 0.2109375}, {-0.546875, -0.671875, 0.2109375}, {0.5546875, -0.671875, 0.28125}, {-0.5546875, -0.671875, 0.28125}, {0.53125, -0.6796875, 0.3359375}, {-0.53125, -0.6796875, 0.3359375}, {0.4140625, -0.75, 0.390625}, {-0.4140625, -0.75, 0.390625}, {0.28125, -0.765625, 0.3984375}, {-0.28125, -0.765625, 0.3984375}, {0.3359375, -0.75, 0.40625}, {-0.3359375, -0.75, 0.40625}, {0.203125, -0.75, 0.171875}, {-0.203125, -0.75, 0.171875}, {0.1953125, -0.75, 0.2265625}, {-0.1953125, -0.75, 0.2265625}, {0.109375, -0.609375, 0.4609375}, {-0.109375, -0.609375, 0.4609375}, {0.1953125, -0.6171875, 0.6640625}, {-0.1953125, -0.6171875, 0.6640625}, {0.3359375, -0.59375, 0.6875}, {-0.3359375, -0.59375, 0.6875}, {0.484375, -0.5546875, 0.5546875}, {-0.484375, -0.5546875, 0.5546875}, {0.6796875, -0.4921875, 0.453125}, {-0.6796875, -0.4921875, 0.453125}, {0.796875, -0.4609375, 0.40625}, {-0.796875, -0.4609375, 0.40625}, {0.7734375, -0.375, 0.1640625}, {-0.7734375, -0.375, 0.1640625}, {0.6015625, -0.4140625, 0.0}, {-0.6015625, -0.4140625, 0.0}, {0.4375, -0.46875, -0.09375}, {-0.4375, -0.46875, -0.09375}, {0.0, -0.2890625, 0.8984375}, {0.0, 0.078125, 0.984375}, {0.0, 0.671875, -0.1953125}, {0.0, -0.1875, -0.4609375}, {0.0, -0.4609375, -0.9765625}, {0.0, -0.34375, -0.8046875}, {0.0, -0.3203125, -0.5703125}, {0.0, -0.28125, -0.484375}, {0.8515625, -0.0546875, 0.234375}, {-0.8515625, -0.0546875, 0.234375}, {0.859375, 0.046875, 0.3203125}, {-0.859375, 0.046875, 0.3203125}, {0.7734375, 0.4375, 0.265625}, {-0.7734375, 0.4375, 0.265625}, {0.4609375, 0.703125, 0.4375}, {-0.4609375, 0.703125, 0.4375}, {0.734375, -0.0703125, -0.046875}, {-0.734375, -0.0703125, -0.046875}, {0.59375, 0.1640625, -0.125}, {-0.59375, 0.1640625, -0.125}, {0.640625, 0.4296875, -0.0078125}, {-0.640625, 0.4296875, -0.0078125}, {0.3359375, 0.6640625, 0.0546875}, {-0.3359375, 0.6640625, 0.0546875}, {0.234375, -0.40625, -0.3515625}, {-0.234375, -0.40625, -0.3515625}, {0.1796875, -0.2578125, -0.4140625}, {-0.1796875, -0.2578125, -0.4140625}, {0.2890625, -0.3828125, -0.7109375}, {-0.2890625, -0.3828125, -0.7109375}, {0.25, -0.390625, -0.5}, {-0.25, -0.390625, -0.5}, {0.328125, -0.3984375, -0.9140625}, {-0.328125, -0.3984375, -0.9140625}, {0.140625, -0.3671875, -0.7578125}, {-0.140625, -0.3671875, -0.7578125}, {0.125, -0.359375, -0.5390625}, {-0.125, -0.359375, -0.5390625}, {0.1640625, -0.4375, -0.9453125}, {-0.1640625, -0.4375, -0.9453125}, {0.21875, -0.4296875, -0.28125}, {-0.21875, -0.4296875, -0.28125}, {0.2109375, -0.46875, -0.2265625}, {-0.2109375, -0.46875, -0.2265625}, {0.203125, -0.5, -0.171875}, {-0.203125, -0.5, -0.171875}, {0.2109375, -0.1640625, -0.390625}, {-0.2109375, -0.1640625, -0.390625}, {0.296875, 0.265625, -0.3125}, {-0.296875, 0.265625, -0.3125}, {0.34375, 0.5390625, -0.1484375}, {-0.34375, 0.5390625, -0.1484375}, {0.453125, 0.3828125, 0.8671875}, {-0.453125, 0.3828125, 0.8671875}, {0.453125, 0.0703125, 0.9296875}, {-0.453125, 0.0703125, 0.9296875}, {0.453125, -0.234375, 0.8515625}, {-0.453125, -0.234375, 0.8515625}, {0.4609375, -0.4296875, 0.5234375}, {-0.4609375, -0.4296875, 0.5234375}, {0.7265625, -0.3359375, 0.40625}, {-0.7265625, -0.3359375, 0.40625}, {0.6328125, -0.28125, 0.453125}, {-0.6328125, -0.28125, 0.453125}, {0.640625, -0.0546875, 0.703125}, {-0.640625, -0.0546875, 0.703125}, {0.796875, -0.125, 0.5625}, {-0.796875, -0.125, 0.5625}, {0.796875, 0.1171875, 0.6171875}, {-0.796875, 0.1171875, 0.6171875}, {0.640625, 0.1953125, 0.75}, {-0.640625, 0.1953125, 0.75}, {0.640625, 0.4453125, 0.6796875}, {-0.640625, 0.4453125, 0.6796875}, {0.796875, 0.359375, 0.5390625}, {-0.796875, 0.359375, 0.5390625}, {0.6171875, 0.5859375, 0.328125}, {-0.6171875, 0.5859375, 0.328125}, {0.484375, 0.546875, 0.0234375}, {-0.484375, 0.546875, 0.0234375}, {0.8203125, 0.203125, 0.328125}, {-0.8203125, 0.203125, 0.328125}, {0.40625, -0.1484375, -0.171875}, {-0.40625, -0.1484375, -0.171875}, {0.4296875, 0.2109375, -0.1953125}, {-0.4296875, 0.2109375, -0.1953125}, {0.890625, 0.234375, 0.40625}, {-0.890625, 0.234375, 0.40625}, {0.7734375, 0.125, -0.140625}, {-0.7734375, 0.125, -0.140625}, {1.0390625, 0.328125, -0.1015625}, {-1.0390625, 0.328125, -0.1015625}, {1.28125, 0.4296875, 0.0546875}, {-1.28125, 0.4296875, 0.0546875}, {1.3515625, 0.421875, 0.3203125}, {-1.3515625, 0.421875, 0.3203125}, {1.234375, 0.421875, 0.5078125}, {-1.234375, 0.421875, 0.5078125}, {1.0234375, 0.3125, 0.4765625}, {-1.0234375, 0.3125, 0.4765625}, {1.015625, 0.2890625, 0.4140625}, {-1.015625, 0.2890625, 0.4140625}, {1.1875, 0.390625, 0.4375}, {-1.1875, 0.390625, 0.4375}, {1.265625, 0.40625, 0.2890625}, {-1.265625, 0.40625, 0.2890625}, {1.2109375, 0.40625, 0.078125}, {-1.2109375, 0.40625, 0.078125}, {1.03125, 0.3046875, -0.0390625}, {-1.03125, 0.3046875, -0.0390625}, {0.828125, 0.1328125, -0.0703125}, {-0.828125, 0.1328125, -0.0703125}, {0.921875, 0.21875, 0.359375}, {-0.921875, 0.21875, 0.359375}, {0.9453125, 0.2890625, 0.3046875}, {-0.9453125, 0.2890625, 0.3046875}, {0.8828125, 0.2109375, -0.0234375}, {-0.8828125, 0.2109375, -0.0234375}, {1.0390625, 0.3671875, 0.0}, {-1.0390625, 0.3671875, 0.0}, {1.1875, 0.4453125, 0.09375}, {-1.1875, 0.4453125, 0.09375}, {1.234375, 0.4453125, 0.25}, {-1.234375, 0.4453125, 0.25}, {1.171875, 0.4375, 0.359375}, {-1.171875, 0.4375, 0.359375}, {1.0234375, 0.359375, 0.34375}, {-1.0234375, 0.359375, 0.34375}, {0.84375, 0.2109375, 0.2890625}, {-0.84375, 0.2109375, 0.2890625}, {0.8359375, 0.2734375, 0.171875}, {-0.8359375, 0.2734375, 0.171875}, {0.7578125, 0.2734375, 0.09375}, {-0.7578125, 0.2734375, 0.09375}, {0.8203125, 0.2734375, 0.0859375}, {-0.8203125, 0.2734375, 0.0859375}, {0.84375, 0.2734375, 0.015625}, {-0.84375, 0.2734375, 0.015625}, {0.8125, 0.2734375, -0.015625}, {-0.8125, 0.2734375, -0.015625}, {0.7265625, 0.0703125, 0.0}, {-0.7265625, 0.0703125, 0.0}, {0.71875, 0.171875, -0.0234375}, {-0.71875, 0.171875, -0.0234375}, {0.71875, 0.1875, 0.0390625}, {-0.71875, 0.1875, 0.0390625}, {0.796875, 0.2109375, 0.203125}, {-0.796875, 0.2109375, 0.203125}, {0.890625, 0.265625, 0.2421875}, {-0.890625, 0.265625, 0.2421875}, {0.890625, 0.3203125, 0.234375}, {-0.890625, 0.3203125, 0.234375}, {0.8125, 0.3203125, -0.015625}, {-0.8125, 0.3203125, -0.015625}, {0.8515625, 0.3203125, 0.015625}, {-0.8515625, 0.3203125, 0.015625}, {0.828125, 0.3203125, 0.078125}, {-0.828125, 0.3203125, 0.078125}, {0.765625, 0.3203125, 0.09375}, {-0.765625, 0.3203125, 0.09375}, {0.84375, 0.3203125, 0.171875}, {-0.84375, 0.3203125, 0.171875}, {1.0390625, 0.4140625, 0.328125}, {-1.0390625, 0.4140625, 0.328125}, {1.1875, 0.484375, 0.34375}, {-1.1875, 0.484375, 0.34375}, {1.2578125, 0.4921875, 0.2421875}, {-1.2578125, 0.4921875, 0.2421875}, {1.2109375, 0.484375, 0.0859375}, {-1.2109375, 0.484375, 0.0859375}, {1.046875, 0.421875, 0.0}, {-1.046875, 0.421875, 0.0}, {0.8828125, 0.265625, -0.015625}, {-0.8828125, 0.265625, -0.015625}, {0.953125, 0.34375, 0.2890625}, {-0.953125, 0.34375, 0.2890625}, {0.890625, 0.328125, 0.109375}, {-0.890625, 0.328125, 0.109375}, {0.9375, 0.3359375, 0.0625}, {-0.9375, 0.3359375, 0.0625}, {1.0, 0.3671875, 0.125}, {-1.0, 0.3671875, 0.125}, {0.9609375, 0.3515625, 0.171875}, {-0.9609375, 0.3515625, 0.171875}, {1.015625, 0.375, 0.234375}, {-1.015625, 0.375, 0.234375}, {1.0546875, 0.3828125, 0.1875}, {-1.0546875, 0.3828125, 0.1875}, {1.109375, 0.390625, 0.2109375}, {-1.109375, 0.390625, 0.2109375}, {1.0859375, 0.390625, 0.2734375}, {-1.0859375, 0.390625, 0.2734375}, {1.0234375, 0.484375, 0.4375}, {-1.0234375, 0.484375, 0.4375}, {1.25, 0.546875, 0.46875}, {-1.25, 0.546875, 0.46875}, {1.3671875, 0.5, 0.296875}, {-1.3671875, 0.5, 0.296875}, {1.3125, 0.53125, 0.0546875}, {-1.3125, 0.53125, 0.0546875}, {1.0390625, 0.4921875, -0.0859375}, {-1.0390625, 0.4921875, -0.0859375}, {0.7890625, 0.328125, -0.125}, {-0.7890625, 0.328125, -0.125}, {0.859375, 0.3828125, 0.3828125}, {-0.859375, 0.3828125, 0.3828125}};
+const Vertex verts5[507] = {{0.4375, -0.765625, 0.1640625}, {-0.4375, -0.765625, 0.1640625}, {0.5, -0.6875, 0.09375}, {-0.5, -0.6875, 0.09375}, {0.546875, -0.578125, 0.0546875}, {-0.546875, -0.578125, 0.0546875}, {0.3515625, -0.6171875, -0.0234375}, {-0.3515625, -0.6171875, -0.0234375}, {0.3515625, -0.71875, 0.03125}, {-0.3515625, -0.71875, 0.03125}, {0.3515625, -0.78125, 0.1328125}, {-0.3515625, -0.78125, 0.1328125}, {0.2734375, -0.796875, 0.1640625}, {-0.2734375, -0.796875, 0.1640625}, {0.203125, -0.7421875, 0.09375}, {-0.203125, -0.7421875, 0.09375}, {0.15625, -0.6484375, 0.0546875}, {-0.15625, -0.6484375, 0.0546875}, {0.078125, -0.65625, 0.2421875}, {-0.078125, -0.65625, 0.2421875}, {0.140625, -0.7421875, 0.2421875}, {-0.140625, -0.7421875, 0.2421875}, {0.2421875, -0.796875, 0.2421875}, {-0.2421875, -0.796875, 0.2421875}, {0.2734375, -0.796875, 0.328125}, {-0.2734375, -0.796875, 0.328125}, {0.203125, -0.7421875, 0.390625}, {-0.203125, -0.7421875, 0.390625}, {0.15625, -0.6484375, 0.4375}, {-0.15625, -0.6484375, 0.4375}, {0.3515625, -0.6171875, 0.515625}, {-0.3515625, -0.6171875, 0.515625}, {0.3515625, -0.71875, 0.453125}, {-0.3515625, -0.71875, 0.453125}, {0.3515625, -0.78125, 0.359375}, {-0.3515625, -0.78125, 0.359375}, {0.4375, -0.765625, 0.328125}, {-0.4375, -0.765625, 0.328125}, {0.5, -0.6875, 0.390625}, {-0.5, -0.6875, 0.390625}, {0.546875, -0.578125, 0.4375}, {-0.546875, -0.578125, 0.4375}, {0.625, -0.5625, 0.2421875}, {-0.625, -0.5625, 0.2421875}, {0.5625, -0.671875, 0.2421875}, {-0.5625, -0.671875, 0.2421875}, {0.46875, -0.7578125, 0.2421875}, {-0.46875, -0.7578125, 0.2421875}, {0.4765625, -0.7734375, 0.2421875}, {-0.4765625, -0.7734375, 0.2421875}, {0.4453125, -0.78125, 0.3359375}, {-0.4453125, -0.78125, 0.3359375}, {0.3515625, -0.8046875, 0.375}, {-0.3515625, -0.8046875, 0.375}, {0.265625, -0.8203125, 0.3359375}, {-0.265625, -0.8203125, 0.3359375}, {0.2265625, -0.8203125, 0.2421875}, {-0.2265625, -0.8203125, 0.2421875}, {0.265625, -0.8203125, 0.15625}, {-0.265625, -0.8203125, 0.15625}, {0.3515625, -0.828125, 0.2421875}, {-0.3515625, -0.828125, 0.2421875}, {0.3515625, -0.8046875, 0.1171875}, {-0.3515625, -0.8046875, 0.1171875}, {0.4453125, -0.78125, 0.15625}, {-0.4453125, -0.78125, 0.15625}, {0.0, -0.7421875, 0.4296875}, {0.0, -0.8203125, 0.3515625}, {0.0, -0.734375, -0.6796875}, {0.0, -0.78125, -0.3203125}, {0.0, -0.796875, -0.1875}, {0.0, -0.71875, -0.7734375}, {0.0, -0.6015625, 0.40625}, {0.0, -0.5703125, 0.5703125}, {0.0, 0.546875, 0.8984375}, {0.0, 0.8515625, 0.5625}, {0.0, 0.828125, 0.0703125}, {0.0, 0.3515625, -0.3828125}, {0.203125, -0.5625, -0.1875}, {-0.203125, -0.5625, -0.1875}, {0.3125, -0.5703125, -0.4375}, {-0.3125, -0.5703125, -0.4375}, {0.3515625, -0.5703125, -0.6953125}, {-0.3515625, -0.5703125, -0.6953125}, {0.3671875, -0.53125, -0.890625}, {-0.3671875, -0.53125, -0.890625}, {0.328125, -0.5234375, -0.9453125}, {-0.328125, -0.5234375, -0.9453125}, {0.1796875, -0.5546875, -0.96875}, {-0.1796875, -0.5546875, -0.96875}, {0.0, -0.578125, -0.984375}, {0.4375, -0.53125, -0.140625}, {-0.4375, -0.53125, -0.140625}, {0.6328125, -0.5390625, -0.0390625}, {-0.6328125, -0.5390625, -0.0390625}, {0.828125, -0.4453125, 0.1484375}, {-0.828125, -0.4453125, 0.1484375}, {0.859375, -0.59375, 0.4296875}, {-0.859375, -0.59375, 0.4296875}, {0.7109375, -0.625, 0.484375}, {-0.7109375, -0.625, 0.484375}, {0.4921875, -0.6875, 0.6015625}, {-0.4921875, -0.6875, 0.6015625}, {0.3203125, -0.734375, 0.7578125}, {-0.3203125, -0.734375, 0.7578125}, {0.15625, -0.7578125, 0.71875}, {-0.15625, -0.7578125, 0.71875}, {0.0625, -0.75, 0.4921875}, {-0.0625, -0.75, 0.4921875}, {0.1640625, -0.7734375, 0.4140625}, {-0.1640625, -0.7734375, 0.4140625}, {0.125, -0.765625, 0.3046875}, {-0.125, -0.765625, 0.3046875}, {0.203125, -0.7421875, 0.09375}, {-0.203125, -0.7421875, 0.09375}, {0.375, -0.703125, 0.015625}, {-0.375, -0.703125, 0.015625}, {0.4921875, -0.671875, 0.0625}, {-0.4921875, -0.671875, 0.0625}, {0.625, -0.6484375, 0.1875}, {-0.625, -0.6484375, 0.1875}, {0.640625, -0.6484375, 0.296875}, {-0.640625, -0.6484375, 0.296875}, {0.6015625, -0.6640625, 0.375}, {-0.6015625, -0.6640625, 0.375}, {0.4296875, -0.71875, 0.4375}, {-0.4296875, -0.71875, 0.4375}, {0.25, -0.7578125, 0.46875}, {-0.25, -0.7578125, 0.46875}, {0.0, -0.734375, -0.765625}, {0.109375, -0.734375, -0.71875}, {-0.109375, -0.734375, -0.71875}, {0.1171875, -0.7109375, -0.8359375}, {-0.1171875, -0.7109375, -0.8359375}, {0.0625, -0.6953125, -0.8828125}, {-0.0625, -0.6953125, -0.8828125}, {0.0, -0.6875, -0.890625}, {0.0, -0.75, -0.1953125}, {0.0, -0.7421875, -0.140625}, {0.1015625, -0.7421875, -0.1484375}, {-0.1015625, -0.7421875, -0.1484375}, {0.125, -0.75, -0.2265625}, {-0.125, -0.75, -0.2265625}, {0.0859375, -0.7421875, -0.2890625}, {-0.0859375, -0.7421875, -0.2890625}, {0.3984375, -0.671875, -0.046875}, {-0.3984375, -0.671875, -0.046875}, {0.6171875, -0.625, 0.0546875}, {-0.6171875, -0.625, 0.0546875}, {0.7265625, -0.6015625, 0.203125}, {-0.7265625, -0.6015625, 0.203125}, {0.7421875, -0.65625, 0.375}, {-0.7421875, -0.65625, 0.375}, {0.6875, -0.7265625, 0.4140625}, {-0.6875, -0.7265625, 0.4140625}, {0.4375, -0.796875, 0.546875}, {-0.4375, -0.796875, 0.546875}, {0.3125, -0.8359375, 0.640625}, {-0.3125, -0.8359375, 0.640625}, {0.203125, -0.8515625, 0.6171875}, {-0.203125, -0.8515625, 0.6171875}, {0.1015625, -0.84375, 0.4296875}, {-0.1015625, -0.84375, 0.4296875}, {0.125, -0.8125, -0.1015625}, {-0.125, -0.8125, -0.1015625}, {0.2109375, -0.7109375, -0.4453125}, {-0.2109375, -0.7109375, -0.4453125}, {0.25, -0.6875, -0.703125}, {-0.25, -0.6875, -0.703125}, {0.265625, -0.6640625, -0.8203125}, {-0.265625, -0.6640625, -0.8203125}, {0.234375, -0.6328125, -0.9140625}, {-0.234375, -0.6328125, -0.9140625}, {0.1640625, -0.6328125, -0.9296875}, {-0.1640625, -0.6328125, -0.9296875}, {0.0, -0.640625, -0.9453125}, {0.0, -0.7265625, 0.046875}, {0.0, -0.765625, 0.2109375}, {0.328125, -0.7421875, 0.4765625}, {-0.328125, -0.7421875, 0.4765625}, {0.1640625, -0.75, 0.140625}, {-0.1640625, -0.75, 0.140625}, {0.1328125, -0.7578125, 0.2109375}, {-0.1328125, -0.7578125, 0.2109375}, {0.1171875, -0.734375, -0.6875}, {-0.1171875, -0.734375, -0.6875}, {0.078125, -0.75, -0.4453125}, {-0.078125, -0.75, -0.4453125}, {0.0, -0.75, -0.4453125}, {0.0, -0.7421875, -0.328125}, {0.09375, -0.78125, -0.2734375}, {-0.09375, -0.78125, -0.2734375}, {0.1328125, -0.796875, -0.2265625}, {-0.1328125, -0.796875, -0.2265625}, {0.109375, -0.78125, -0.1328125}, {-0.109375, -0.78125, -0.1328125}, {0.0390625, -0.78125, -0.125}, {-0.0390625, -0.78125, -0.125}, {0.0, -0.828125, -0.203125}, {0.046875, -0.8125, -0.1484375}, {-0.046875, -0.8125, -0.1484375}, {0.09375, -0.8125, -0.15625}, {-0.09375, -0.8125, -0.15625}, {0.109375, -0.828125, -0.2265625}, {-0.109375, -0.828125, -0.2265625}, {0.078125, -0.8046875, -0.25}, {-0.078125, -0.8046875, -0.25}, {0.0, -0.8046875, -0.2890625}, {0.2578125, -0.5546875, -0.3125}, {-0.2578125, -0.5546875, -0.3125}, {0.1640625, -0.7109375, -0.2421875}, {-0.1640625, -0.7109375, -0.2421875}, {0.1796875, -0.7109375, -0.3125}, {-0.1796875, -0.7109375, -0.3125}, {0.234375, -0.5546875, -0.25}, {-0.234375, -0.5546875, -0.25}, {0.0, -0.6875, -0.875}, {0.046875, -0.6875, -0.8671875}, {-0.046875, -0.6875, -0.8671875}, {0.09375, -0.7109375, -0.8203125}, {-0.09375, -0.7109375, -0.8203125}, {0.09375, -0.7265625, -0.7421875}, {-0.09375, -0.7265625, -0.7421875}, {0.0, -0.65625, -0.78125}, {0.09375, -0.6640625, -0.75}, {-0.09375, -0.6640625, -0.75}, {0.09375, -0.640625, -0.8125}, {-0.09375, -0.640625, -0.8125}, {0.046875, -0.6328125, -0.8515625}, {-0.046875, -0.6328125, -0.8515625}, {0.0, -0.6328125, -0.859375}, {0.171875, -0.78125, 0.21875}, {-0.171875, -0.78125, 0.21875}, {0.1875, -0.7734375, 0.15625}, {-0.1875, -0.7734375, 0.15625}, {0.3359375, -0.7578125, 0.4296875}, {-0.3359375, -0.7578125, 0.4296875}, {0.2734375, -0.7734375, 0.421875}, {-0.2734375, -0.7734375, 0.421875}, {0.421875, -0.7734375, 0.3984375}, {-0.421875, -0.7734375, 0.3984375}, {0.5625, -0.6953125, 0.3515625}, {-0.5625, -0.6953125, 0.3515625}, {0.5859375, -0.6875, 0.2890625}, {-0.5859375, -0.6875, 0.2890625}, {0.578125, -0.6796875, 0.1953125}, {-0.578125, -0.6796875, 0.1953125}, {0.4765625, -0.71875, 0.1015625}, {-0.4765625, -0.71875, 0.1015625}, {0.375, -0.7421875, 0.0625}, {-0.375, -0.7421875, 0.0625}, {0.2265625, -0.78125, 0.109375}, {-0.2265625, -0.78125, 0.109375}, {0.1796875, -0.78125, 0.296875}, {-0.1796875, -0.78125, 0.296875}, {0.2109375, -0.78125, 0.375}, {-0.2109375, -0.78125, 0.375}, {0.234375, -0.7578125, 0.359375}, {-0.234375, -0.7578125, 0.359375}, {0.1953125, -0.7578125, 0.296875}, {-0.1953125, -0.7578125, 0.296875}, {0.2421875, -0.7578125, 0.125}, {-0.2421875, -0.7578125, 0.125}, {0.375, -0.7265625, 0.0859375}, {-0.375, -0.7265625, 0.0859375}, {0.4609375, -0.703125, 0.1171875}, {-0.4609375, -0.703125, 0.1171875}, {0.546875, -0.671875, 0.2109375}, {-0.546875, -0.671875, 0.2109375}, {0.5546875, -0.671875, 0.28125}, {-0.5546875, -0.671875, 0.28125}, {0.53125, -0.6796875, 0.3359375}, {-0.53125, -0.6796875, 0.3359375}, {0.4140625, -0.75, 0.390625}, {-0.4140625, -0.75, 0.390625}, {0.28125, -0.765625, 0.3984375}, {-0.28125, -0.765625, 0.3984375}, {0.3359375, -0.75, 0.40625}, {-0.3359375, -0.75, 0.40625}, {0.203125, -0.75, 0.171875}, {-0.203125, -0.75, 0.171875}, {0.1953125, -0.75, 0.2265625}, {-0.1953125, -0.75, 0.2265625}, {0.109375, -0.609375, 0.4609375}, {-0.109375, -0.609375, 0.4609375}, {0.1953125, -0.6171875, 0.6640625}, {-0.1953125, -0.6171875, 0.6640625}, {0.3359375, -0.59375, 0.6875}, {-0.3359375, -0.59375, 0.6875}, {0.484375, -0.5546875, 0.5546875}, {-0.484375, -0.5546875, 0.5546875}, {0.6796875, -0.4921875, 0.453125}, {-0.6796875, -0.4921875, 0.453125}, {0.796875, -0.4609375, 0.40625}, {-0.796875, -0.4609375, 0.40625}, {0.7734375, -0.375, 0.1640625}, {-0.7734375, -0.375, 0.1640625}, {0.6015625, -0.4140625, 0.0}, {-0.6015625, -0.4140625, 0.0}, {0.4375, -0.46875, -0.09375}, {-0.4375, -0.46875, -0.09375}, {0.0, -0.2890625, 0.8984375}, {0.0, 0.078125, 0.984375}, {0.0, 0.671875, -0.1953125}, {0.0, -0.1875, -0.4609375}, {0.0, -0.4609375, -0.9765625}, {0.0, -0.34375, -0.8046875}, {0.0, -0.3203125, -0.5703125}, {0.0, -0.28125, -0.484375}, {0.8515625, -0.0546875, 0.234375}, {-0.8515625, -0.0546875, 0.234375}, {0.859375, 0.046875, 0.3203125}, {-0.859375, 0.046875, 0.3203125}, {0.7734375, 0.4375, 0.265625}, {-0.7734375, 0.4375, 0.265625}, {0.4609375, 0.703125, 0.4375}, {-0.4609375, 0.703125, 0.4375}, {0.734375, -0.0703125, -0.046875}, {-0.734375, -0.0703125, -0.046875}, {0.59375, 0.1640625, -0.125}, {-0.59375, 0.1640625, -0.125}, {0.640625, 0.4296875, -0.0078125}, {-0.640625, 0.4296875, -0.0078125}, {0.3359375, 0.6640625, 0.0546875}, {-0.3359375, 0.6640625, 0.0546875}, {0.234375, -0.40625, -0.3515625}, {-0.234375, -0.40625, -0.3515625}, {0.1796875, -0.2578125, -0.4140625}, {-0.1796875, -0.2578125, -0.4140625}, {0.2890625, -0.3828125, -0.7109375}, {-0.2890625, -0.3828125, -0.7109375}, {0.25, -0.390625, -0.5}, {-0.25, -0.390625, -0.5}, {0.328125, -0.3984375, -0.9140625}, {-0.328125, -0.3984375, -0.9140625}, {0.140625, -0.3671875, -0.7578125}, {-0.140625, -0.3671875, -0.7578125}, {0.125, -0.359375, -0.5390625}, {-0.125, -0.359375, -0.5390625}, {0.1640625, -0.4375, -0.9453125}, {-0.1640625, -0.4375, -0.9453125}, {0.21875, -0.4296875, -0.28125}, {-0.21875, -0.4296875, -0.28125}, {0.2109375, -0.46875, -0.2265625}, {-0.2109375, -0.46875, -0.2265625}, {0.203125, -0.5, -0.171875}, {-0.203125, -0.5, -0.171875}, {0.2109375, -0.1640625, -0.390625}, {-0.2109375, -0.1640625, -0.390625}, {0.296875, 0.265625, -0.3125}, {-0.296875, 0.265625, -0.3125}, {0.34375, 0.5390625, -0.1484375}, {-0.34375, 0.5390625, -0.1484375}, {0.453125, 0.3828125, 0.8671875}, {-0.453125, 0.3828125, 0.8671875}, {0.453125, 0.0703125, 0.9296875}, {-0.453125, 0.0703125, 0.9296875}, {0.453125, -0.234375, 0.8515625}, {-0.453125, -0.234375, 0.8515625}, {0.4609375, -0.4296875, 0.5234375}, {-0.4609375, -0.4296875, 0.5234375}, {0.7265625, -0.3359375, 0.40625}, {-0.7265625, -0.3359375, 0.40625}, {0.6328125, -0.28125, 0.453125}, {-0.6328125, -0.28125, 0.453125}, {0.640625, -0.0546875, 0.703125}, {-0.640625, -0.0546875, 0.703125}, {0.796875, -0.125, 0.5625}, {-0.796875, -0.125, 0.5625}, {0.796875, 0.1171875, 0.6171875}, {-0.796875, 0.1171875, 0.6171875}, {0.640625, 0.1953125, 0.75}, {-0.640625, 0.1953125, 0.75}, {0.640625, 0.4453125, 0.6796875}, {-0.640625, 0.4453125, 0.6796875}, {0.796875, 0.359375, 0.5390625}, {-0.796875, 0.359375, 0.5390625}, {0.6171875, 0.5859375, 0.328125}, {-0.6171875, 0.5859375, 0.328125}, {0.484375, 0.546875, 0.0234375}, {-0.484375, 0.546875, 0.0234375}, {0.8203125, 0.203125, 0.328125}, {-0.8203125, 0.203125, 0.328125}, {0.40625, -0.1484375, -0.171875}, {-0.40625, -0.1484375, -0.171875}, {0.4296875, 0.2109375, -0.1953125}, {-0.4296875, 0.2109375, -0.1953125}, {0.890625, 0.234375, 0.40625}, {-0.890625, 0.234375, 0.40625}, {0.7734375, 0.125, -0.140625}, {-0.7734375, 0.125, -0.140625}, {1.0390625, 0.328125, -0.1015625}, {-1.0390625, 0.328125, -0.1015625}, {1.28125, 0.4296875, 0.0546875}, {-1.28125, 0.4296875, 0.0546875}, {1.3515625, 0.421875, 0.3203125}, {-1.3515625, 0.421875, 0.3203125}, {1.234375, 0.421875, 0.5078125}, {-1.234375, 0.421875, 0.5078125}, {1.0234375, 0.3125, 0.4765625}, {-1.0234375, 0.3125, 0.4765625}, {1.015625, 0.2890625, 0.4140625}, {-1.015625, 0.2890625, 0.4140625}, {1.1875, 0.390625, 0.4375}, {-1.1875, 0.390625, 0.4375}, {1.265625, 0.40625, 0.2890625}, {-1.265625, 0.40625, 0.2890625}, {1.2109375, 0.40625, 0.078125}, {-1.2109375, 0.40625, 0.078125}, {1.03125, 0.3046875, -0.0390625}, {-1.03125, 0.3046875, -0.0390625}, {0.828125, 0.1328125, -0.0703125}, {-0.828125, 0.1328125, -0.0703125}, {0.921875, 0.21875, 0.359375}, {-0.921875, 0.21875, 0.359375}, {0.9453125, 0.2890625, 0.3046875}, {-0.9453125, 0.2890625, 0.3046875}, {0.8828125, 0.2109375, -0.0234375}, {-0.8828125, 0.2109375, -0.0234375}, {1.0390625, 0.3671875, 0.0}, {-1.0390625, 0.3671875, 0.0}, {1.1875, 0.4453125, 0.09375}, {-1.1875, 0.4453125, 0.09375}, {1.234375, 0.4453125, 0.25}, {-1.234375, 0.4453125, 0.25}, {1.171875, 0.4375, 0.359375}, {-1.171875, 0.4375, 0.359375}, {1.0234375, 0.359375, 0.34375}, {-1.0234375, 0.359375, 0.34375}, {0.84375, 0.2109375, 0.2890625}, {-0.84375, 0.2109375, 0.2890625}, {0.8359375, 0.2734375, 0.171875}, {-0.8359375, 0.2734375, 0.171875}, {0.7578125, 0.2734375, 0.09375}, {-0.7578125, 0.2734375, 0.09375}, {0.8203125, 0.2734375, 0.0859375}, {-0.8203125, 0.2734375, 0.0859375}, {0.84375, 0.2734375, 0.015625}, {-0.84375, 0.2734375, 0.015625}, {0.8125, 0.2734375, -0.015625}, {-0.8125, 0.2734375, -0.015625}, {0.7265625, 0.0703125, 0.0}, {-0.7265625, 0.0703125, 0.0}, {0.71875, 0.171875, -0.0234375}, {-0.71875, 0.171875, -0.0234375}, {0.71875, 0.1875, 0.0390625}, {-0.71875, 0.1875, 0.0390625}, {0.796875, 0.2109375, 0.203125}, {-0.796875, 0.2109375, 0.203125}, {0.890625, 0.265625, 0.2421875}, {-0.890625, 0.265625, 0.2421875}, {0.890625, 0.3203125, 0.234375}, {-0.890625, 0.3203125, 0.234375}, {0.8125, 0.3203125, -0.015625}, {-0.8125, 0.3203125, -0.015625}, {0.8515625, 0.3203125, 0.015625}, {-0.8515625, 0.3203125, 0.015625}, {0.828125, 0.3203125, 0.078125}, {-0.828125, 0.3203125, 0.078125}, {0.765625, 0.3203125, 0.09375}, {-0.765625, 0.3203125, 0.09375}, {0.84375, 0.3203125, 0.171875}, {-0.84375, 0.3203125, 0.171875}, {1.0390625, 0.4140625, 0.328125}, {-1.0390625, 0.4140625, 0.328125}, {1.1875, 0.484375, 0.34375}, {-1.1875, 0.484375, 0.34375}, {1.2578125, 0.4921875, 0.2421875}, {-1.2578125, 0.4921875, 0.2421875}, {1.2109375, 0.484375, 0.0859375}, {-1.2109375, 0.484375, 0.0859375}, {1.046875, 0.421875, 0.0}, {-1.046875, 0.421875, 0.0}, {0.8828125, 0.265625, -0.015625}, {-0.8828125, 0.265625, -0.015625}, {0.953125, 0.34375, 0.2890625}, {-0.953125, 0.34375, 0.2890625}, {0.890625, 0.328125, 0.109375}, {-0.890625, 0.328125, 0.109375}, {0.9375, 0.3359375, 0.0625}, {-0.9375, 0.3359375, 0.0625}, {1.0, 0.3671875, 0.125}, {-1.0, 0.3671875, 0.125}, {0.9609375, 0.3515625, 0.171875}, {-0.9609375, 0.3515625, 0.171875}, {1.015625, 0.375, 0.234375}, {-1.015625, 0.375, 0.234375}, {1.0546875, 0.3828125, 0.1875}, {-1.0546875, 0.3828125, 0.1875}, {1.109375, 0.390625, 0.2109375}, {-1.109375, 0.390625, 0.2109375}, {1.0859375, 0.390625, 0.2734375}, {-1.0859375, 0.390625, 0.2734375}, {1.0234375, 0.484375, 0.4375}, {-1.0234375, 0.484375, 0.4375}, {1.25, 0.546875, 0.46875}, {-1.25, 0.546875, 0.46875}, {1.3671875, 0.5, 0.296875}, {-1.3671875, 0.5, 0.296875}, {1.3125, 0.53125, 0.0546875}, {-1.3125, 0.53125, 0.0546875}, {1.0390625, 0.4921875, -0.0859375}, {-1.0390625, 0.4921875, -0.0859375}, {0.7890625, 0.328125, -0.125}, {-0.7890625, 0.328125, -0.125}, {0.859375, 0.3828125, 0.3828125}, {-0.859375, 0.3828125, 0.3828125}};
 const unsigned short faces5[468][4] = {{46, 0, 2, 44}, {3, 1, 47, 45}, {44, 2, 4, 42}, {5, 3, 45, 43}, {2, 8, 6, 4}, {7, 9, 3, 5}, {0, 10, 8, 2}, {9, 11, 1, 3}, {10, 12, 14, 8}, {15, 13, 11, 9}, {8, 14, 16, 6}, {17, 15, 9, 7}, {14, 20, 18, 16}, {19, 21, 15, 17}, {12, 22, 20, 14}, {21, 23, 13, 15}, {22, 24, 26, 20}, {27, 25, 23, 21}, {20, 26, 28, 18}, {29, 27, 21, 19}, {26, 32, 30, 28}, {31, 33, 27, 29}, {24, 34, 32, 26}, {33, 35, 25, 27}, {34, 36, 38, 32}, {39, 37, 35, 33}, {32, 38, 40, 30}, {41, 39, 33, 31}, {38, 44, 42, 40}, {43, 45, 39, 41}, {36, 46, 44, 38}, {45, 47, 37, 39}, {46, 36, 50, 48}, {51, 37, 47, 49}, {36, 34, 52, 50}, {53, 35, 37, 51}, {34, 24, 54, 52}, {55, 25, 35, 53}, {24, 22, 56, 54}, {57, 23, 25, 55}, {22, 12, 58, 56}, {59, 13, 23, 57}, {12, 10, 62, 58}, {63, 11, 13, 59}, {10, 0, 64, 62}, {65, 1, 11, 63}, {0, 46, 48, 64}, {49, 47, 1, 65}, {88, 173, 175, 90}, {175, 174, 89, 90}, {86, 171, 173, 88}, {174, 172, 87, 89}, {84, 169, 171, 86}, {172, 170, 85, 87}, {82, 167, 169, 84}, {170, 168, 83, 85}, {80, 165, 167, 82}, {168, 166, 81, 83}, {78, 91, 145, 163}, {146, 92, 79, 164}, {91, 93, 147, 145}, {148, 94, 92, 146}, {93, 95, 149, 147}, {150, 96, 94, 148}, {95, 97, 151, 149}, {152, 98, 96, 150}, {97, 99, 153, 151}, {154, 100, 98, 152}, {99, 101, 155, 153}, {156, 102, 100, 154}, {101, 103, 157, 155}, {158, 104, 102, 156}, {103, 105, 159, 157}, {160, 106, 104, 158}, {105, 107, 161, 159}, {162, 108, 106, 160}, {107, 66, 67, 161}, {67, 66, 108, 162}, {109, 127, 159, 161}, {160, 128, 110, 162}, {127, 178, 157, 159}, {158, 179, 128, 160}, {125, 155, 157, 178}, {158, 156, 126, 179}, {123, 153, 155, 125}, {156, 154, 124, 126}, {121, 151, 153, 123}, {154, 152, 122, 124}, {119, 149, 151, 121}, {152, 150, 120, 122}, {117, 147, 149, 119}, {150, 148, 118, 120}, {115, 145, 147, 117}, {148, 146, 116, 118}, {113, 163, 145, 115}, {146, 164, 114, 116}, {113, 180, 176, 163}, {176, 181, 114, 164}, {109, 161, 67, 111}, {67, 162, 110, 112}, {111, 67, 177, 182}, {177, 67, 112, 183}, {176, 180, 182, 177}, {183, 181, 176, 177}, {134, 136, 175, 173}, {175, 136, 135, 174}, {132, 134, 173, 171}, {174, 135, 133, 172}, {130, 132, 171, 169}, {172, 133, 131, 170}, {165, 186, 184, 167}, {185, 187, 166, 168}, {130, 169, 167, 184}, {168, 170, 131, 185}, {143, 189, 188, 186}, {188, 189, 144, 187}, {184, 186, 188, 68}, {188, 187, 185, 68}, {129, 130, 184, 68}, {185, 131, 129, 68}, {141, 192, 190, 143}, {191, 193, 142, 144}, {139, 194, 192, 141}, {193, 195, 140, 142}, {138, 196, 194, 139}, {195, 197, 138, 140}, {137, 70, 196, 138}, {197, 70, 137, 138}, {189, 143, 190, 69}, {191, 144, 189, 69}, {69, 190, 205, 207}, {206, 191, 69, 207}, {70, 198, 199, 196}, {200, 198, 70, 197}, {196, 199, 201, 194}, {202, 200, 197, 195}, {194, 201, 203, 192}, {204, 202, 195, 193}, {192, 203, 205, 190}, {206, 204, 193, 191}, {198, 203, 201, 199}, {202, 204, 198, 200}, {198, 207, 205, 203}, {206, 207, 198, 204}, {138, 139, 163, 176}, {164, 140, 138, 176}, {139, 141, 210, 163}, {211, 142, 140, 164}, {141, 143, 212, 210}, {213, 144, 142, 211}, {143, 186, 165, 212}, {166, 187, 144, 213}, {80, 208, 212, 165}, {213, 209, 81, 166}, {208, 214, 210, 212}, {211, 215, 209, 213}, {78, 163, 210, 214}, {211, 164, 79, 215}, {130, 129, 71, 221}, {71, 129, 131, 222}, {132, 130, 221, 219}, {222, 131, 133, 220}, {134, 132, 219, 217}, {220, 133, 135, 218}, {136, 134, 217, 216}, {218, 135, 136, 216}, {216, 217, 228, 230}, {229, 218, 216, 230}, {217, 219, 226, 228}, {227, 220, 218, 229}, {219, 221, 224, 226}, {225, 222, 220, 227}, {221, 71, 223, 224}, {223, 71, 222, 225}, {223, 230, 228, 224}, {229, 230, 223, 225}, {182, 180, 233, 231}, {234, 181, 183, 232}, {111, 182, 231, 253}, {232, 183, 112, 254}, {109, 111, 253, 255}, {254, 112, 110, 256}, {180, 113, 251, 233}, {252, 114, 181, 234}, {113, 115, 249, 251}, {250, 116, 114, 252}, {115, 117, 247, 249}, {248, 118, 116, 250}, {117, 119, 245, 247}, {246, 120, 118, 248}, {119, 121, 243, 245}, {244, 122, 120, 246}, {121, 123, 241, 243}, {242, 124, 122, 244}, {123, 125, 239, 241}, {240, 126, 124, 242}, {125, 178, 235, 239}, {236, 179, 126, 240}, {178, 127, 237, 235}, {238, 128, 179, 236}, {127, 109, 255, 237}, {256, 110, 128, 238}, {237, 255, 257, 275}, {258, 256, 238, 276}, {235, 237, 275, 277}, {276, 238, 236, 278}, {239, 235, 277, 273}, {278, 236, 240, 274}, {241, 239, 273, 271}, {274, 240, 242, 272}, {243, 241, 271, 269}, {272, 242, 244, 270}, {245, 243, 269, 267}, {270, 244, 246, 268}, {247, 245, 267, 265}, {268, 246, 248, 266}, {249, 247, 265, 263}, {266, 248, 250, 264}, {251, 249, 263, 261}, {264, 250, 252, 262}, {233, 251, 261, 279}, {262, 252, 234, 280}, {255, 253, 259, 257}, {260, 254, 256, 258}, {253, 231, 281, 259}, {282, 232, 254, 260}, {231, 233, 279, 281}, {280, 234, 232, 282}, {66, 107, 283, 72}, {284, 108, 66, 72}, {107, 105, 285, 283}, {286, 106, 108, 284}, {105, 103, 287, 285}, {288, 104, 106, 286}, {103, 101, 289, 287}, {290, 102, 104, 288}, {101, 99, 291, 289}, {292, 100, 102, 290}, {99, 97, 293, 291}, {294, 98, 100, 292}, {97, 95, 295, 293}, {296, 96, 98, 294}, {95, 93, 297, 295}, {298, 94, 96, 296}, {93, 91, 299, 297}, {300, 92, 94, 298}, {307, 308, 327, 337}, {328, 308, 307, 338}, {306, 307, 337, 335}, {338, 307, 306, 336}, {305, 306, 335, 339}, {336, 306, 305, 340}, {88, 90, 305, 339}, {305, 90, 89, 340}, {86, 88, 339, 333}, {340, 89, 87, 334}, {84, 86, 333, 329}, {334, 87, 85, 330}, {82, 84, 329, 331}, {330, 85, 83, 332}, {329, 335, 337, 331}, {338, 336, 330, 332}, {329, 333, 339, 335}, {340, 334, 330, 336}, {325, 331, 337, 327}, {338, 332, 326, 328}, {80, 82, 331, 325}, {332, 83, 81, 326}, {208, 341, 343, 214}, {344, 342, 209, 215}, {80, 325, 341, 208}, {342, 326, 81, 209}, {78, 214, 343, 345}, {344, 215, 79, 346}, {78, 345, 299, 91}, {300, 346, 79, 92}, {76, 323, 351, 303}, {352, 324, 76, 303}, {303, 351, 349, 77}, {350, 352, 303, 77}, {77, 349, 347, 304}, {348, 350, 77, 304}, {304, 347, 327, 308}, {328, 348, 304, 308}, {325, 327, 347, 341}, {348, 328, 326, 342}, {295, 297, 317, 309}, {318, 298, 296, 310}, {75, 315, 323, 76}, {324, 316, 75, 76}, {301, 357, 355, 302}, {356, 358, 301, 302}, {302, 355, 353, 74}, {354, 356, 302, 74}, {74, 353, 315, 75}, {316, 354, 74, 75}, {291, 293, 361, 363}, {362, 294, 292, 364}, {363, 361, 367, 365}, {368, 362, 364, 366}, {365, 367, 369, 371}, {370, 368, 366, 372}, {371, 369, 375, 373}, {376, 370, 372, 374}, {313, 377, 373, 375}, {374, 378, 314, 376}, {315, 353, 373, 377}, {374, 354, 316, 378}, {353, 355, 371, 373}, {372, 356, 354, 374}, {355, 357, 365, 371}, {366, 358, 356, 372}, {357, 359, 363, 365}, {364, 360, 358, 366}, {289, 291, 363, 359}, {364, 292, 290, 360}, {73, 359, 357, 301}, {358, 360, 73, 301}, {283, 285, 287, 289}, {288, 286, 284, 290}, {283, 289, 359, 73}, {360, 290, 284, 73}, {293, 295, 309, 361}, {310, 296, 294, 362}, {309, 311, 367, 361}, {368, 312, 310, 362}, {311, 381, 369, 367}, {370, 382, 312, 368}, {313, 375, 369, 381}, {370, 376, 314, 382}, {347, 349, 385, 383}, {386, 350, 348, 384}, {317, 383, 385, 319}, {386, 384, 318, 320}, {297, 299, 383, 317}, {384, 300, 298, 318}, {299, 343, 341, 383}, {342, 344, 300, 384}, {313, 321, 379, 377}, {380, 322, 314, 378}, {315, 377, 379, 323}, {380, 378, 316, 324}, {319, 385, 379, 321}, {380, 386, 320, 322}, {349, 351, 379, 385}, {380, 352, 350, 386}, {399, 387, 413, 401}, {414, 388, 400, 402}, {399, 401, 403, 397}, {404, 402, 400, 398}, {397, 403, 405, 395}, {406, 404, 398, 396}, {395, 405, 407, 393}, {408, 406, 396, 394}, {393, 407, 409, 391}, {410, 408, 394, 392}, {391, 409, 411, 389}, {412, 410, 392, 390}, {409, 419, 417, 411}, {418, 420, 410, 412}, {407, 421, 419, 409}, {420, 422, 408, 410}, {405, 423, 421, 407}, {422, 424, 406, 408}, {403, 425, 423, 405}, {424, 426, 404, 406}, {401, 427, 425, 403}, {426, 428, 402, 404}, {401, 413, 415, 427}, {416, 414, 402, 428}, {317, 319, 443, 441}, {444, 320, 318, 442}, {319, 389, 411, 443}, {412, 390, 320, 444}, {309, 317, 441, 311}, {442, 318, 310, 312}, {381, 429, 413, 387}, {414, 430, 382, 388}, {411, 417, 439, 443}, {440, 418, 412, 444}, {437, 445, 443, 439}, {444, 446, 438, 440}, {433, 445, 437, 435}, {438, 446, 434, 436}, {431, 447, 445, 433}, {446, 448, 432, 434}, {429, 447, 431, 449}, {432, 448, 430, 450}, {413, 429, 449, 415}, {450, 430, 414, 416}, {311, 447, 429, 381}, {430, 448, 312, 382}, {311, 441, 445, 447}, {446, 442, 312, 448}, {415, 449, 451, 475}, {452, 450, 416, 476}, {449, 431, 461, 451}, {462, 432, 450, 452}, {431, 433, 459, 461}, {460, 434, 432, 462}, {433, 435, 457, 459}, {458, 436, 434, 460}, {435, 437, 455, 457}, {456, 438, 436, 458}, {437, 439, 453, 455}, {454, 440, 438, 456}, {439, 417, 473, 453}, {474, 418, 440, 454}, {427, 415, 475, 463}, {476, 416, 428, 464}, {425, 427, 463, 465}, {464, 428, 426, 466}, {423, 425, 465, 467}, {466, 426, 424, 468}, {421, 423, 467, 469}, {468, 424, 422, 470}, {419, 421, 469, 471}, {470, 422, 420, 472}, {417, 419, 471, 473}, {472, 420, 418, 474}, {457, 455, 479, 477}, {480, 456, 458, 478}, {477, 479, 481, 483}, {482, 480, 478, 484}, {483, 481, 487, 485}, {488, 482, 484, 486}, {485, 487, 489, 491}, {490, 488, 486, 492}, {463, 475, 485, 491}, {486, 476, 464, 492}, {451, 483, 485, 475}, {486, 484, 452, 476}, {451, 461, 477, 483}, {478, 462, 452, 484}, {457, 477, 461, 459}, {462, 478, 458, 460}, {453, 473, 479, 455}, {480, 474, 454, 456}, {471, 481, 479, 473}, {480, 482, 472, 474}, {469, 487, 481, 471}, {482, 488, 470, 472}, {467, 489, 487, 469}, {488, 490, 468, 470}, {465, 491, 489, 467}, {490, 492, 466, 468}, {391, 389, 503, 501}, {504, 390, 392, 502}, {393, 391, 501, 499}, {502, 392, 394, 500}, {395, 393, 499, 497}, {500, 394, 396, 498}, {397, 395, 497, 495}, {498, 396, 398, 496}, {399, 397, 495, 493}, {496, 398, 400, 494}, {387, 399, 493, 505}, {494, 400, 388, 506}, {493, 501, 503, 505}, {504, 502, 494, 506}, {493, 495, 499, 501}, {500, 496, 494, 502}, {313, 381, 387, 505}, {388, 382, 314, 506}, {313, 505, 503, 321}, {504, 506, 314, 322}, {319, 321, 503, 389}, {504, 322, 320, 390}};
 
-ObjData suzanne_object = {verts5, faces5[0], 468};
+ObjData suzanne_object = {verts5, 507, faces5[0], 468, 1.486};
 
-const Vector3 verts6[182] = {{0.0, 0.30901700258255005, 0.9510565400123596}, {0.0, 0.9510565400123596, 0.30901697278022766}, {0.0, 0.9510564804077148, -0.30901703238487244}, {0.0, 0.5877851843833923, -0.8090170621871948}, {0.0, 0.30901679396629333, -0.9510565996170044}, {0.09549161046743393, 0.29389262199401855, 0.9510565400123596}, {0.18163573741912842, 0.55901700258255, 0.80901700258255}, {0.25000008940696716, 0.7694209218025208, 0.5877852439880371}, {0.2938927412033081, 0.9045085310935974, 0.30901697278022766}, {0.3090170919895172, 0.9510565400123596, -4.371138828673793e-08}, {0.2938927114009857, 0.9045084714889526, -0.30901703238487244}, {0.25000008940696716, 0.7694209218025208, -0.5877851843833923}, {0.18163572251796722, 0.5590169429779053, -0.8090170621871948}, {0.09549155086278915, 0.29389241337776184, -0.9510565996170044}, {0.18163584172725677, 0.24999995529651642, 0.9510565400123596}, {0.3454917073249817, 0.4755282402038574, 0.80901700258255}, {0.47552844882011414, 0.6545085310935974, 0.5877852439880371}, {0.5590172410011292, 0.769420862197876, 0.30901697278022766}, {0.5877854824066162, 0.80901700258255, -4.371138828673793e-08}, {0.5590171813964844, 0.7694208025932312, -0.30901703238487244}, {0.47552844882011414, 0.6545085310935974, -0.5877851843833923}, {0.3454916775226593, 0.47552818059921265, -0.8090170621871948}, {0.18163572251796722, 0.2499997615814209, -0.9510565996170044}, {0.2500002682209015, 0.1816355139017105, 0.9510565400123596}, {0.4755285382270813, 0.3454913794994354, 0.80901700258255}, {0.6545088291168213, 0.47552821040153503, 0.5877852439880371}, {0.7694212198257446, 0.5590169429779053, 0.30901697278022766}, {0.8090173602104187, 0.5877852439880371, -4.371138828673793e-08}, {0.7694211602210999, 0.5590168833732605, -0.30901703238487244}, {0.6545088291168213, 0.47552821040153503, -0.5877851843833923}, {0.4755285084247589, 0.34549134969711304, -0.8090170621871948}, {0.25000008940696716, 0.18163536489009857, -0.9510565996170044}, {0.2938929498195648, 0.09549129754304886, 0.9510565400123596}, {0.5590173602104187, 0.18163542449474335, 0.80901700258255}, {0.7694213390350342, 0.24999983608722687, 0.5877852439880371}, {0.9045089483261108, 0.2938924729824066, 0.30901697278022766}, {0.9510570168495178, 0.3090168535709381, -4.371138828673793e-08}, {0.9045088291168213, 0.29389241337776184, -0.30901703238487244}, {0.7694213390350342, 0.24999983608722687, -0.5877851843833923}, {0.5590173006057739, 0.18163539469242096, -0.8090170621871948}, {0.2938927412033081, 0.0954912006855011, -0.9510565996170044}, {0.3090173304080963, -3.139710145205754e-07, 0.9510565400123596}, {0.5877856612205505, -3.2887217571442307e-07, 0.80901700258255}, {0.8090174794197083, -2.9906985332672775e-07, 0.5877852439880371}, {0.9510570168495178, -3.139710145205754e-07, 0.30901697278022766}, {1.0000005960464478, -3.139710145205754e-07, -4.371138828673793e-08}, {0.9510568976402283, -3.437733369082707e-07, -0.30901703238487244}, {0.8090174794197083, -2.9906985332672775e-07, -0.5877851843833923}, {0.5877856016159058, -3.437733369082707e-07, -0.8090170621871948}, {0.3090171217918396, -3.363227563113469e-07, -0.9510565996170044}, {0.2938929498195648, -0.095491923391819, 0.9510565400123596}, {0.5590174198150635, -0.18163609504699707, 0.80901700258255}, {0.7694213390350342, -0.2500004768371582, 0.5877852439880371}, {0.9045090079307556, -0.29389312863349915, 0.30901697278022766}, {0.9510571360588074, -0.30901750922203064, -4.371138828673793e-08}, {0.9045088887214661, -0.29389309883117676, -0.30901703238487244}, {0.7694213390350342, -0.2500004768371582, -0.5877851843833923}, {0.5590173602104187, -0.18163608014583588, -0.8090170621871948}, {0.2938927412033081, -0.09549187868833542, -0.9510565996170044}, {0.2500002682209015, -0.18163615465164185, 0.9510565400123596}, {0.4755285978317261, -0.34549209475517273, 0.80901700258255}, {0.6545088887214661, -0.47552886605262756, 0.5877852439880371}, {0.7694213390350342, -0.5590176582336426, 0.30901697278022766}, {0.8090175986289978, -0.5877859592437744, -4.371138828673793e-08}, {0.7694212198257446, -0.559017539024353, -0.30901703238487244}, {0.6545088887214661, -0.47552886605262756, -0.5877851843833923}, {0.4755285680294037, -0.34549209475517273, -0.8090170621871948}, {0.25000008940696716, -0.1816360503435135, -0.9510565996170044}, {0.18163584172725677, -0.25000062584877014, 0.9510565400123596}, {0.3454917371273041, -0.4755289852619171, 0.80901700258255}, {0.4755285680294037, -0.6545091867446899, 0.5877852439880371}, {0.5590173602104187, -0.7694216966629028, 0.30901697278022766}, {0.5877857208251953, -0.8090178370475769, -4.371138828673793e-08}, {0.5590172410011292, -0.7694215178489685, -0.30901703238487244}, {0.4755285680294037, -0.6545091867446899, -0.5877851843833923}, {0.3454917371273041, -0.4755289852619171, -0.8090170621871948}, {0.18163569271564484, -0.2500004470348358, -0.9510565996170044}, {0.09549161791801453, -0.29389333724975586, 0.9510565400123596}, {0.18163573741912842, -0.5590177774429321, 0.80901700258255}, {0.2500001788139343, -0.7694216966629028, 0.5877852439880371}, {0.2938928008079529, -0.904509425163269, 0.30901697278022766}, {0.3090173006057739, -0.951057493686676, -4.371138828673793e-08}, {0.2938927412033081, -0.9045091867446899, -0.30901703238487244}, {0.2500001788139343, -0.7694216966629028, -0.5877851843833923}, {0.18163573741912842, -0.5590177774429321, -0.8090170621871948}, {0.09549152106046677, -0.29389312863349915, -0.9510565996170044}, {-1.1068188143781299e-08, -0.30901774764060974, 0.9510565400123596}, {-4.832109112840044e-08, -0.587786078453064, 0.80901700258255}, {1.1283553646990185e-08, -0.8090178370475769, 0.5877852439880371}, {-1.8518768740705127e-08, -0.951057493686676, 0.30901697278022766}, {7.088819842238081e-08, -1.000001072883606, -4.371138828673793e-08}, {1.1283553646990185e-08, -0.9510572552680969, -0.30901703238487244}, {1.1283553646990185e-08, -0.8090178370475769, -0.5877851843833923}, {-4.832109112840044e-08, -0.587786078453064, -0.8090170621871948}, {-3.3419929934552783e-08, -0.30901750922203064, -0.9510565996170044}, {-0.09549164026975632, -0.29389336705207825, 0.9510565400123596}, {-0.18163582682609558, -0.5590177774429321, 0.80901700258255}, {-0.2500001788139343, -0.7694216966629028, 0.5877852439880371}, {-0.29389289021492004, -0.904509425163269, 0.30901697278022766}, {-0.3090171813964844, -0.9510575532913208, -4.371138828673793e-08}, {-0.2938927710056305, -0.9045092463493347, -0.30901703238487244}, {-0.2500001788139343, -0.7694216966629028, -0.5877851843833923}, {-0.18163582682609558, -0.5590177774429321, -0.8090170621871948}, {-0.09549158811569214, -0.29389315843582153, -0.9510565996170044}, {-0.18163590133190155, -0.2500007152557373, 0.9510565400123596}, {-0.34549185633659363, -0.4755289852619171, 0.80901700258255}, {-0.4755285978317261, -0.6545092463493347, 0.5877852439880371}, {-0.5590174198150635, -0.7694216966629028, 0.30901697278022766}, {-0.5877856016159058, -0.8090178966522217, -4.371138828673793e-08}, {-0.5590173006057739, -0.7694215774536133, -0.30901703238487244}, {-0.4755285978317261, -0.6545092463493347, -0.5877851843833923}, {-0.34549185633659363, -0.4755289852619171, -0.8090170621871948}, {-0.181635782122612, -0.2500005066394806, -0.9510565996170044}, {-2.6361124128015945e-07, -5.17366174790368e-07, 1.0}, {-0.25000038743019104, -0.1816362589597702, 0.9510565400123596}, {-0.475528746843338, -0.3454921245574951, 0.80901700258255}, {-0.6545089483261108, -0.47552892565727234, 0.5877852439880371}, {-0.7694214582443237, -0.5590176582336426, 0.30901697278022766}, {-0.809017539024353, -0.5877860188484192, -4.371138828673793e-08}, {-0.7694212794303894, -0.559017539024353, -0.30901703238487244}, {-0.6545089483261108, -0.47552892565727234, -0.5877851843833923}, {-0.475528746843338, -0.3454921245574951, -0.8090170621871948}, {-0.2500002086162567, -0.18163608014583588, -0.9510565996170044}, {-0.29389309883117676, -0.09549199044704437, 0.9510565400123596}, {-0.559017539024353, -0.18163609504699707, 0.80901700258255}, {-0.7694214582443237, -0.2500005066394806, 0.5877852439880371}, {-0.9045091271400452, -0.29389312863349915, 0.30901697278022766}, {-0.9510571360588074, -0.3090175688266754, -4.371138828673793e-08}, {-0.9045089483261108, -0.29389306902885437, -0.30901703238487244}, {-0.7694214582443237, -0.2500005066394806, -0.5877851843833923}, {-0.559017539024353, -0.18163609504699707, -0.8090170621871948}, {-0.29389289021492004, -0.09549187868833542, -0.9510565996170044}, {-0.30901750922203064, -3.2887217571442307e-07, 0.9510565400123596}, {-0.5877857804298401, -2.841686921328801e-07, 0.80901700258255}, {-0.8090175986289978, -3.139710145205754e-07, 0.5877852439880371}, {-0.9510571956634521, -2.841686921328801e-07, 0.30901697278022766}, {-1.0000007152557373, -3.7357565929596603e-07, -4.371138828673793e-08}, {-0.951056957244873, -2.841686921328801e-07, -0.30901703238487244}, {-0.8090175986289978, -3.139710145205754e-07, -0.5877851843833923}, {-0.5877857804298401, -2.841686921328801e-07, -0.8090170621871948}, {-0.3090173006057739, -2.916192727298039e-07, -0.9510565996170044}, {-0.29389312863349915, 0.09549133479595184, 0.9510565400123596}, {-0.5590174794197083, 0.1816355139017105, 0.80901700258255}, {-0.7694214582443237, 0.24999986588954926, 0.5877852439880371}, {-0.9045091271400452, 0.2938925325870514, 0.30901697278022766}, {-0.9510571956634521, 0.3090168237686157, -4.371138828673793e-08}, {-0.9045088887214661, 0.2938924729824066, -0.30901703238487244}, {-0.7694214582443237, 0.24999986588954926, -0.5877851843833923}, {-0.5590174794197083, 0.1816355139017105, -0.8090170621871948}, {-0.29389292001724243, 0.09549131244421005, -0.9510565996170044}, {0.0, -3.2584136988589307e-07, -1.0}, {-0.2500004470348358, 0.18163561820983887, 0.9510565400123596}, {-0.47552865743637085, 0.34549152851104736, 0.80901700258255}, {-0.6545089483261108, 0.4755282700061798, 0.5877852439880371}, {-0.769421398639679, 0.5590171217918396, 0.30901697278022766}, {-0.8090175986289978, 0.5877853035926819, -4.371138828673793e-08}, {-0.7694212198257446, 0.5590169429779053, -0.30901703238487244}, {-0.6545089483261108, 0.4755282700061798, -0.5877851843833923}, {-0.47552865743637085, 0.34549152851104736, -0.8090170621871948}, {-0.2500002384185791, 0.1816355288028717, -0.9510565996170044}, {-0.18163596093654633, 0.25000011920928955, 0.9510565400123596}, {-0.34549179673194885, 0.47552838921546936, 0.80901700258255}, {-0.47552862763404846, 0.654508650302887, 0.5877852439880371}, {-0.5590173006057739, 0.7694211602210999, 0.30901697278022766}, {-0.5877857208251953, 0.8090172410011292, -4.371138828673793e-08}, {-0.5590171813964844, 0.7694209814071655, -0.30901703238487244}, {-0.47552862763404846, 0.654508650302887, -0.5877851843833923}, {-0.34549179673194885, 0.47552838921546936, -0.8090170621871948}, {-0.181635782122612, 0.2499999701976776, -0.9510565996170044}, {-0.0954916700720787, 0.29389283061027527, 0.9510565400123596}, {-0.1816357672214508, 0.5590172410011292, 0.80901700258255}, {-0.2500002384185791, 0.7694211602210999, 0.5877852439880371}, {-0.2938927114009857, 0.9045088291168213, 0.30901697278022766}, {-0.3090173006057739, 0.951056957244873, -4.371138828673793e-08}, {-0.29389265179634094, 0.9045087099075317, -0.30901703238487244}, {-0.2500002384185791, 0.7694211602210999, -0.5877851843833923}, {-0.1816357672214508, 0.5590172410011292, -0.8090170621871948}, {-0.09549155086278915, 0.29389262199401855, -0.9510565996170044}, {5.5987037228533154e-08, 0.587785542011261, 0.80901700258255}, {-3.3419929934552783e-08, 0.8090173006057739, 0.5877852439880371}, {-4.832109112840044e-08, 1.0000005960464478, -4.371138828673793e-08}, {-3.3419929934552783e-08, 0.8090173006057739, -0.5877851843833923}};
+const Vertex verts6[182] = {{0.0, 0.30901700258255005, 0.9510565400123596}, {0.0, 0.9510565400123596, 0.30901697278022766}, {0.0, 0.9510564804077148, -0.30901703238487244}, {0.0, 0.5877851843833923, -0.8090170621871948}, {0.0, 0.30901679396629333, -0.9510565996170044}, {0.09549161046743393, 0.29389262199401855, 0.9510565400123596}, {0.18163573741912842, 0.55901700258255, 0.80901700258255}, {0.25000008940696716, 0.7694209218025208, 0.5877852439880371}, {0.2938927412033081, 0.9045085310935974, 0.30901697278022766}, {0.3090170919895172, 0.9510565400123596, -4.371138828673793e-08}, {0.2938927114009857, 0.9045084714889526, -0.30901703238487244}, {0.25000008940696716, 0.7694209218025208, -0.5877851843833923}, {0.18163572251796722, 0.5590169429779053, -0.8090170621871948}, {0.09549155086278915, 0.29389241337776184, -0.9510565996170044}, {0.18163584172725677, 0.24999995529651642, 0.9510565400123596}, {0.3454917073249817, 0.4755282402038574, 0.80901700258255}, {0.47552844882011414, 0.6545085310935974, 0.5877852439880371}, {0.5590172410011292, 0.769420862197876, 0.30901697278022766}, {0.5877854824066162, 0.80901700258255, -4.371138828673793e-08}, {0.5590171813964844, 0.7694208025932312, -0.30901703238487244}, {0.47552844882011414, 0.6545085310935974, -0.5877851843833923}, {0.3454916775226593, 0.47552818059921265, -0.8090170621871948}, {0.18163572251796722, 0.2499997615814209, -0.9510565996170044}, {0.2500002682209015, 0.1816355139017105, 0.9510565400123596}, {0.4755285382270813, 0.3454913794994354, 0.80901700258255}, {0.6545088291168213, 0.47552821040153503, 0.5877852439880371}, {0.7694212198257446, 0.5590169429779053, 0.30901697278022766}, {0.8090173602104187, 0.5877852439880371, -4.371138828673793e-08}, {0.7694211602210999, 0.5590168833732605, -0.30901703238487244}, {0.6545088291168213, 0.47552821040153503, -0.5877851843833923}, {0.4755285084247589, 0.34549134969711304, -0.8090170621871948}, {0.25000008940696716, 0.18163536489009857, -0.9510565996170044}, {0.2938929498195648, 0.09549129754304886, 0.9510565400123596}, {0.5590173602104187, 0.18163542449474335, 0.80901700258255}, {0.7694213390350342, 0.24999983608722687, 0.5877852439880371}, {0.9045089483261108, 0.2938924729824066, 0.30901697278022766}, {0.9510570168495178, 0.3090168535709381, -4.371138828673793e-08}, {0.9045088291168213, 0.29389241337776184, -0.30901703238487244}, {0.7694213390350342, 0.24999983608722687, -0.5877851843833923}, {0.5590173006057739, 0.18163539469242096, -0.8090170621871948}, {0.2938927412033081, 0.0954912006855011, -0.9510565996170044}, {0.3090173304080963, -3.139710145205754e-07, 0.9510565400123596}, {0.5877856612205505, -3.2887217571442307e-07, 0.80901700258255}, {0.8090174794197083, -2.9906985332672775e-07, 0.5877852439880371}, {0.9510570168495178, -3.139710145205754e-07, 0.30901697278022766}, {1.0000005960464478, -3.139710145205754e-07, -4.371138828673793e-08}, {0.9510568976402283, -3.437733369082707e-07, -0.30901703238487244}, {0.8090174794197083, -2.9906985332672775e-07, -0.5877851843833923}, {0.5877856016159058, -3.437733369082707e-07, -0.8090170621871948}, {0.3090171217918396, -3.363227563113469e-07, -0.9510565996170044}, {0.2938929498195648, -0.095491923391819, 0.9510565400123596}, {0.5590174198150635, -0.18163609504699707, 0.80901700258255}, {0.7694213390350342, -0.2500004768371582, 0.5877852439880371}, {0.9045090079307556, -0.29389312863349915, 0.30901697278022766}, {0.9510571360588074, -0.30901750922203064, -4.371138828673793e-08}, {0.9045088887214661, -0.29389309883117676, -0.30901703238487244}, {0.7694213390350342, -0.2500004768371582, -0.5877851843833923}, {0.5590173602104187, -0.18163608014583588, -0.8090170621871948}, {0.2938927412033081, -0.09549187868833542, -0.9510565996170044}, {0.2500002682209015, -0.18163615465164185, 0.9510565400123596}, {0.4755285978317261, -0.34549209475517273, 0.80901700258255}, {0.6545088887214661, -0.47552886605262756, 0.5877852439880371}, {0.7694213390350342, -0.5590176582336426, 0.30901697278022766}, {0.8090175986289978, -0.5877859592437744, -4.371138828673793e-08}, {0.7694212198257446, -0.559017539024353, -0.30901703238487244}, {0.6545088887214661, -0.47552886605262756, -0.5877851843833923}, {0.4755285680294037, -0.34549209475517273, -0.8090170621871948}, {0.25000008940696716, -0.1816360503435135, -0.9510565996170044}, {0.18163584172725677, -0.25000062584877014, 0.9510565400123596}, {0.3454917371273041, -0.4755289852619171, 0.80901700258255}, {0.4755285680294037, -0.6545091867446899, 0.5877852439880371}, {0.5590173602104187, -0.7694216966629028, 0.30901697278022766}, {0.5877857208251953, -0.8090178370475769, -4.371138828673793e-08}, {0.5590172410011292, -0.7694215178489685, -0.30901703238487244}, {0.4755285680294037, -0.6545091867446899, -0.5877851843833923}, {0.3454917371273041, -0.4755289852619171, -0.8090170621871948}, {0.18163569271564484, -0.2500004470348358, -0.9510565996170044}, {0.09549161791801453, -0.29389333724975586, 0.9510565400123596}, {0.18163573741912842, -0.5590177774429321, 0.80901700258255}, {0.2500001788139343, -0.7694216966629028, 0.5877852439880371}, {0.2938928008079529, -0.904509425163269, 0.30901697278022766}, {0.3090173006057739, -0.951057493686676, -4.371138828673793e-08}, {0.2938927412033081, -0.9045091867446899, -0.30901703238487244}, {0.2500001788139343, -0.7694216966629028, -0.5877851843833923}, {0.18163573741912842, -0.5590177774429321, -0.8090170621871948}, {0.09549152106046677, -0.29389312863349915, -0.9510565996170044}, {-1.1068188143781299e-08, -0.30901774764060974, 0.9510565400123596}, {-4.832109112840044e-08, -0.587786078453064, 0.80901700258255}, {1.1283553646990185e-08, -0.8090178370475769, 0.5877852439880371}, {-1.8518768740705127e-08, -0.951057493686676, 0.30901697278022766}, {7.088819842238081e-08, -1.000001072883606, -4.371138828673793e-08}, {1.1283553646990185e-08, -0.9510572552680969, -0.30901703238487244}, {1.1283553646990185e-08, -0.8090178370475769, -0.5877851843833923}, {-4.832109112840044e-08, -0.587786078453064, -0.8090170621871948}, {-3.3419929934552783e-08, -0.30901750922203064, -0.9510565996170044}, {-0.09549164026975632, -0.29389336705207825, 0.9510565400123596}, {-0.18163582682609558, -0.5590177774429321, 0.80901700258255}, {-0.2500001788139343, -0.7694216966629028, 0.5877852439880371}, {-0.29389289021492004, -0.904509425163269, 0.30901697278022766}, {-0.3090171813964844, -0.9510575532913208, -4.371138828673793e-08}, {-0.2938927710056305, -0.9045092463493347, -0.30901703238487244}, {-0.2500001788139343, -0.7694216966629028, -0.5877851843833923}, {-0.18163582682609558, -0.5590177774429321, -0.8090170621871948}, {-0.09549158811569214, -0.29389315843582153, -0.9510565996170044}, {-0.18163590133190155, -0.2500007152557373, 0.9510565400123596}, {-0.34549185633659363, -0.4755289852619171, 0.80901700258255}, {-0.4755285978317261, -0.6545092463493347, 0.5877852439880371}, {-0.5590174198150635, -0.7694216966629028, 0.30901697278022766}, {-0.5877856016159058, -0.8090178966522217, -4.371138828673793e-08}, {-0.5590173006057739, -0.7694215774536133, -0.30901703238487244}, {-0.4755285978317261, -0.6545092463493347, -0.5877851843833923}, {-0.34549185633659363, -0.4755289852619171, -0.8090170621871948}, {-0.181635782122612, -0.2500005066394806, -0.9510565996170044}, {-2.6361124128015945e-07, -5.17366174790368e-07, 1.0}, {-0.25000038743019104, -0.1816362589597702, 0.9510565400123596}, {-0.475528746843338, -0.3454921245574951, 0.80901700258255}, {-0.6545089483261108, -0.47552892565727234, 0.5877852439880371}, {-0.7694214582443237, -0.5590176582336426, 0.30901697278022766}, {-0.809017539024353, -0.5877860188484192, -4.371138828673793e-08}, {-0.7694212794303894, -0.559017539024353, -0.30901703238487244}, {-0.6545089483261108, -0.47552892565727234, -0.5877851843833923}, {-0.475528746843338, -0.3454921245574951, -0.8090170621871948}, {-0.2500002086162567, -0.18163608014583588, -0.9510565996170044}, {-0.29389309883117676, -0.09549199044704437, 0.9510565400123596}, {-0.559017539024353, -0.18163609504699707, 0.80901700258255}, {-0.7694214582443237, -0.2500005066394806, 0.5877852439880371}, {-0.9045091271400452, -0.29389312863349915, 0.30901697278022766}, {-0.9510571360588074, -0.3090175688266754, -4.371138828673793e-08}, {-0.9045089483261108, -0.29389306902885437, -0.30901703238487244}, {-0.7694214582443237, -0.2500005066394806, -0.5877851843833923}, {-0.559017539024353, -0.18163609504699707, -0.8090170621871948}, {-0.29389289021492004, -0.09549187868833542, -0.9510565996170044}, {-0.30901750922203064, -3.2887217571442307e-07, 0.9510565400123596}, {-0.5877857804298401, -2.841686921328801e-07, 0.80901700258255}, {-0.8090175986289978, -3.139710145205754e-07, 0.5877852439880371}, {-0.9510571956634521, -2.841686921328801e-07, 0.30901697278022766}, {-1.0000007152557373, -3.7357565929596603e-07, -4.371138828673793e-08}, {-0.951056957244873, -2.841686921328801e-07, -0.30901703238487244}, {-0.8090175986289978, -3.139710145205754e-07, -0.5877851843833923}, {-0.5877857804298401, -2.841686921328801e-07, -0.8090170621871948}, {-0.3090173006057739, -2.916192727298039e-07, -0.9510565996170044}, {-0.29389312863349915, 0.09549133479595184, 0.9510565400123596}, {-0.5590174794197083, 0.1816355139017105, 0.80901700258255}, {-0.7694214582443237, 0.24999986588954926, 0.5877852439880371}, {-0.9045091271400452, 0.2938925325870514, 0.30901697278022766}, {-0.9510571956634521, 0.3090168237686157, -4.371138828673793e-08}, {-0.9045088887214661, 0.2938924729824066, -0.30901703238487244}, {-0.7694214582443237, 0.24999986588954926, -0.5877851843833923}, {-0.5590174794197083, 0.1816355139017105, -0.8090170621871948}, {-0.29389292001724243, 0.09549131244421005, -0.9510565996170044}, {0.0, -3.2584136988589307e-07, -1.0}, {-0.2500004470348358, 0.18163561820983887, 0.9510565400123596}, {-0.47552865743637085, 0.34549152851104736, 0.80901700258255}, {-0.6545089483261108, 0.4755282700061798, 0.5877852439880371}, {-0.769421398639679, 0.5590171217918396, 0.30901697278022766}, {-0.8090175986289978, 0.5877853035926819, -4.371138828673793e-08}, {-0.7694212198257446, 0.5590169429779053, -0.30901703238487244}, {-0.6545089483261108, 0.4755282700061798, -0.5877851843833923}, {-0.47552865743637085, 0.34549152851104736, -0.8090170621871948}, {-0.2500002384185791, 0.1816355288028717, -0.9510565996170044}, {-0.18163596093654633, 0.25000011920928955, 0.9510565400123596}, {-0.34549179673194885, 0.47552838921546936, 0.80901700258255}, {-0.47552862763404846, 0.654508650302887, 0.5877852439880371}, {-0.5590173006057739, 0.7694211602210999, 0.30901697278022766}, {-0.5877857208251953, 0.8090172410011292, -4.371138828673793e-08}, {-0.5590171813964844, 0.7694209814071655, -0.30901703238487244}, {-0.47552862763404846, 0.654508650302887, -0.5877851843833923}, {-0.34549179673194885, 0.47552838921546936, -0.8090170621871948}, {-0.181635782122612, 0.2499999701976776, -0.9510565996170044}, {-0.0954916700720787, 0.29389283061027527, 0.9510565400123596}, {-0.1816357672214508, 0.5590172410011292, 0.80901700258255}, {-0.2500002384185791, 0.7694211602210999, 0.5877852439880371}, {-0.2938927114009857, 0.9045088291168213, 0.30901697278022766}, {-0.3090173006057739, 0.951056957244873, -4.371138828673793e-08}, {-0.29389265179634094, 0.9045087099075317, -0.30901703238487244}, {-0.2500002384185791, 0.7694211602210999, -0.5877851843833923}, {-0.1816357672214508, 0.5590172410011292, -0.8090170621871948}, {-0.09549155086278915, 0.29389262199401855, -0.9510565996170044}, {5.5987037228533154e-08, 0.587785542011261, 0.80901700258255}, {-3.3419929934552783e-08, 0.8090173006057739, 0.5877852439880371}, {-4.832109112840044e-08, 1.0000005960464478, -4.371138828673793e-08}, {-3.3419929934552783e-08, 0.8090173006057739, -0.5877851843833923}};
 const unsigned short faces6[160][4] = {{2, 180, 9, 10}, {179, 178, 6, 7}, {181, 2, 10, 11}, {1, 179, 7, 8}, {3, 181, 11, 12}, {180, 1, 8, 9}, {178, 0, 5, 6}, {4, 3, 12, 13}, {10, 9, 18, 19}, {7, 6, 15, 16}, {11, 10, 19, 20}, {8, 7, 16, 17}, {12, 11, 20, 21}, {9, 8, 17, 18}, {6, 5, 14, 15}, {13, 12, 21, 22}, {15, 14, 23, 24}, {22, 21, 30, 31}, {19, 18, 27, 28}, {16, 15, 24, 25}, {20, 19, 28, 29}, {17, 16, 25, 26}, {21, 20, 29, 30}, {18, 17, 26, 27}, {27, 26, 35, 36}, {24, 23, 32, 33}, {31, 30, 39, 40}, {28, 27, 36, 37}, {25, 24, 33, 34}, {29, 28, 37, 38}, {26, 25, 34, 35}, {30, 29, 38, 39}, {39, 38, 47, 48}, {36, 35, 44, 45}, {33, 32, 41, 42}, {40, 39, 48, 49}, {37, 36, 45, 46}, {34, 33, 42, 43}, {38, 37, 46, 47}, {35, 34, 43, 44}, {47, 46, 55, 56}, {44, 43, 52, 53}, {48, 47, 56, 57}, {45, 44, 53, 54}, {42, 41, 50, 51}, {49, 48, 57, 58}, {46, 45, 54, 55}, {43, 42, 51, 52}, {52, 51, 60, 61}, {56, 55, 64, 65}, {53, 52, 61, 62}, {57, 56, 65, 66}, {54, 53, 62, 63}, {51, 50, 59, 60}, {58, 57, 66, 67}, {55, 54, 63, 64}, {64, 63, 72, 73}, {61, 60, 69, 70}, {65, 64, 73, 74}, {62, 61, 70, 71}, {66, 65, 74, 75}, {63, 62, 71, 72}, {60, 59, 68, 69}, {67, 66, 75, 76}, {69, 68, 77, 78}, {76, 75, 84, 85}, {73, 72, 81, 82}, {70, 69, 78, 79}, {74, 73, 82, 83}, {71, 70, 79, 80}, {75, 74, 83, 84}, {72, 71, 80, 81}, {84, 83, 92, 93}, {81, 80, 89, 90}, {78, 77, 86, 87}, {85, 84, 93, 94}, {82, 81, 90, 91}, {79, 78, 87, 88}, {83, 82, 91, 92}, {80, 79, 88, 89}, {89, 88, 97, 98}, {93, 92, 101, 102}, {90, 89, 98, 99}, {87, 86, 95, 96}, {94, 93, 102, 103}, {91, 90, 99, 100}, {88, 87, 96, 97}, {92, 91, 100, 101}, {101, 100, 109, 110}, {98, 97, 106, 107}, {102, 101, 110, 111}, {99, 98, 107, 108}, {96, 95, 104, 105}, {103, 102, 111, 112}, {100, 99, 108, 109}, {97, 96, 105, 106}, {106, 105, 115, 116}, {110, 109, 119, 120}, {107, 106, 116, 117}, {111, 110, 120, 121}, {108, 107, 117, 118}, {105, 104, 114, 115}, {112, 111, 121, 122}, {109, 108, 118, 119}, {122, 121, 130, 131}, {119, 118, 127, 128}, {116, 115, 124, 125}, {120, 119, 128, 129}, {117, 116, 125, 126}, {121, 120, 129, 130}, {118, 117, 126, 127}, {115, 114, 123, 124}, {127, 126, 135, 136}, {124, 123, 132, 133}, {131, 130, 139, 140}, {128, 127, 136, 137}, {125, 124, 133, 134}, {129, 128, 137, 138}, {126, 125, 134, 135}, {130, 129, 138, 139}, {139, 138, 147, 148}, {136, 135, 144, 145}, {133, 132, 141, 142}, {140, 139, 148, 149}, {137, 136, 145, 146}, {134, 133, 142, 143}, {138, 137, 146, 147}, {135, 134, 143, 144}, {144, 143, 153, 154}, {148, 147, 157, 158}, {145, 144, 154, 155}, {142, 141, 151, 152}, {149, 148, 158, 159}, {146, 145, 155, 156}, {143, 142, 152, 153}, {147, 146, 156, 157}, {157, 156, 165, 166}, {154, 153, 162, 163}, {158, 157, 166, 167}, {155, 154, 163, 164}, {152, 151, 160, 161}, {159, 158, 167, 168}, {156, 155, 164, 165}, {153, 152, 161, 162}, {165, 164, 173, 174}, {162, 161, 170, 171}, {166, 165, 174, 175}, {163, 162, 171, 172}, {167, 166, 175, 176}, {164, 163, 172, 173}, {161, 160, 169, 170}, {168, 167, 176, 177}, {170, 169, 0, 178}, {177, 176, 3, 4}, {174, 173, 180, 2}, {171, 170, 178, 179}, {175, 174, 2, 181}, {172, 171, 179, 1}, {176, 175, 181, 3}, {173, 172, 1, 180}};
 
-ObjData sphere_object = {verts6, faces6[0], 160};
+ObjData sphere_object = {verts6, 182, faces6[0], 160, 1.001};
 
 
-const char controlButtons[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0xf9, 0xe0, 
-    0x00, 0x00, 0x00, 0x01, 0x30, 0x50, 
-    0x00, 0x00, 0x00, 0x01, 0x20, 0x50, 
-    0x00, 0x00, 0x00, 0x01, 0x01, 0xe0, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 
-    0x00, 0x00, 0x03, 0x81, 0x01, 0xf0, 
-    0x00, 0x00, 0x08, 0x21, 0x00, 0x10, 
-    0x00, 0x00, 0x13, 0x91, 0x00, 0x10, 
-    0x00, 0x00, 0x04, 0x41, 0x00, 0x00, 
-    0x00, 0x00, 0x28, 0x29, 0x01, 0xf0, 
-    0x00, 0x00, 0x08, 0x21, 0x01, 0x50, 
-    0x00, 0x00, 0x28, 0x29, 0x01, 0x50, 
-    0x00, 0x00, 0x04, 0x41, 0x01, 0x10, 
-    0x00, 0x00, 0x23, 0x89, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x09, 0x00, 0x00, 
-    0x00, 0x3f, 0xdf, 0xf7, 0xf8, 0x00, 
-    0x00, 0xc0, 0x20, 0x08, 0x06, 0x00, 
-    0x00, 0x9c, 0x00, 0x00, 0x72, 0x00, 
-    0x01, 0x22, 0x20, 0x08, 0x89, 0x00, 
-    0x01, 0x41, 0x00, 0x01, 0x05, 0x00, 
-    0x01, 0x41, 0x20, 0x09, 0x05, 0x00, 
-    0x01, 0x41, 0x00, 0x01, 0x05, 0x00, 
-    0x01, 0x22, 0x20, 0x08, 0x89, 0x00, 
-    0x00, 0x9c, 0x00, 0x00, 0x72, 0x00, 
-    0x00, 0xc0, 0x20, 0x08, 0x06, 0x00, 
-    0x00, 0x3f, 0xdf, 0xf7, 0xf8, 0x00, 
-    0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x23, 0x88, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x28, 0x28, 0x00, 0x00, 
-    0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x28, 0x28, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x13, 0x90, 0x00, 0x00, 
-    0x00, 0x00, 0x08, 0x20, 0x00, 0x00, 
-    0x0f, 0x80, 0x03, 0x80, 0x00, 0x00, 
-    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x0f, 0x80, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x08, 0x84, 0x01, 0x00, 0x00, 0x00, 
-    0x08, 0x8c, 0x01, 0x00, 0x00, 0x00, 
-    0x07, 0x1f, 0xff, 0x00, 0x00, 0x00, 
-    0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x84, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 
-    0x0a, 0x80, 0x00, 0x00, 0x00, 0x00, 
-    0x0a, 0x80, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// control screens, generated from PBM captures with host/build/spriteenc
+// control_buttons: 84x48, 222 bytes (504 unencoded)
+const unsigned char control_buttons_data[222] = {
+    0x81, 0x00, 0x1E, 0xF0, 0x50, 0xD0, 0x20, 0x00, 0xE0, 0x10, 0x10, 0xE0, 
+    0x00, 0x10, 0x10, 0xF0, 0x10, 0x10, 0x00, 0xE0, 0x50, 0x50, 0xE0, 0x00, 
+    0x10, 0x10, 0xF0, 0x10, 0x10, 0x00, 0xF0, 0x50, 0x50, 0x10, 0xB2, 0x00, 
+    0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x81, 0x00, 0x07, 
+    0x01, 0x00, 0x20, 0x30, 0xF9, 0x30, 0x20, 0x01, 0x80, 0x00, 0x00, 0x01, 
+    0x80, 0x00, 0x81, 0x01, 0x80, 0x00, 0x03, 0xF8, 0x06, 0x72, 0x89, 0x80, 
+    0x05, 0x03, 0x89, 0x72, 0x06, 0xF8, 0xB4, 0x00, 0x84, 0x01, 0x20, 0x81, 
+    0x21, 0x91, 0x41, 0x29, 0x21, 0x29, 0x41, 0x89, 0x01, 0x09, 0xF7, 0x08, 
+    0x00, 0x08, 0x01, 0x09, 0x01, 0x08, 0x00, 0x08, 0xF7, 0x08, 0x00, 0x88, 
+    0x40, 0x28, 0x20, 0x28, 0x40, 0x90, 0x20, 0x80, 0xB0, 0x00, 0x20, 0x03, 
+    0x08, 0x13, 0x04, 0x28, 0x08, 0x28, 0x04, 0x23, 0x00, 0x20, 0xDF, 0x20, 
+    0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0xDF, 0x20, 0x00, 0x23, 
+    0x04, 0x28, 0x08, 0x28, 0x04, 0x13, 0x08, 0x03, 0x85, 0x01, 0x00, 0xFF, 
+    0xB2, 0x00, 0x03, 0x3F, 0xC0, 0x9C, 0x22, 0x80, 0x41, 0x03, 0x22, 0x9C, 
+    0xC0, 0x3F, 0x87, 0x00, 0x00, 0x80, 0x80, 0x00, 0x07, 0x80, 0x00, 0x00, 
+    0x84, 0x8C, 0x1F, 0x0C, 0x84, 0x80, 0x00, 0x01, 0x80, 0x00, 0x81, 0x80, 
+    0xAA, 0x00, 0x82, 0x01, 0x8A, 0x00, 0x14, 0x0F, 0x01, 0x02, 0x01, 0x0F, 
+    0x00, 0x07, 0x08, 0x08, 0x07, 0x00, 0x01, 0x06, 0x08, 0x06, 0x01, 0x00, 
+    0x0F, 0x0A, 0x0A, 0x08, 0x81, 0x00
 };
+const Sprite control_buttons = {84, 48, SPRITE_RLE, control_buttons_data};
 
-const char controlJoystick[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x1f, 0x28, 
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x44, 
-    0x00, 0x00, 0x03, 0x80, 0x0d, 0x54, 
-    0x00, 0x00, 0x03, 0x00, 0x12, 0x28, 
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x40, 0x0e, 0x7c, 
-    0x00, 0x00, 0x00, 0x40, 0x11, 0x44, 
-    0x00, 0x70, 0x00, 0x00, 0x11, 0x44, 
-    0x00, 0x8c, 0x00, 0x00, 0x0e, 0x38, 
-    0x01, 0x02, 0x00, 0xc0, 0x00, 0x00, 
-    0x01, 0x01, 0x01, 0x20, 0x01, 0x00, 
-    0x02, 0x00, 0x82, 0x50, 0x01, 0x00, 
-    0x02, 0x00, 0x84, 0x88, 0x1f, 0x38, 
-    0x02, 0x00, 0x44, 0x88, 0x01, 0x44, 
-    0x04, 0x00, 0xf8, 0x04, 0x01, 0x44, 
-    0x04, 0x01, 0x08, 0x04, 0x00, 0x28, 
-    0x04, 0x00, 0x08, 0x04, 0x1e, 0x00, 
-    0x04, 0x02, 0x08, 0x04, 0x05, 0x78, 
-    0x04, 0x02, 0x08, 0x04, 0x05, 0x14, 
-    0x04, 0x02, 0x08, 0x04, 0x1e, 0x14, 
-    0x04, 0x00, 0x08, 0x04, 0x00, 0x78, 
-    0x04, 0x01, 0x08, 0x04, 0x01, 0x00, 
-    0x04, 0x00, 0xf8, 0x04, 0x01, 0x7c, 
-    0x02, 0x00, 0x44, 0x08, 0x1f, 0x08, 
-    0x02, 0x00, 0x84, 0x88, 0x01, 0x10, 
-    0x02, 0x00, 0x82, 0x50, 0x01, 0x08, 
-    0x01, 0x01, 0x01, 0x20, 0x00, 0x7c, 
-    0x01, 0x02, 0x00, 0xc0, 0x11, 0x00, 
-    0x00, 0x8c, 0x00, 0x00, 0x1f, 0x7c, 
-    0x00, 0x70, 0x00, 0x00, 0x11, 0x54, 
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x54, 
-    0x00, 0x00, 0x00, 0x40, 0x0e, 0x44, 
-    0x00, 0x00, 0x02, 0x80, 0x11, 0x00, 
-    0x00, 0x00, 0x03, 0x00, 0x11, 0x7c, 
-    0x00, 0x00, 0x03, 0x80, 0x0e, 0x14, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 
-    0x00, 0x00, 0x00, 0x00, 0x1f, 0x48, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x78, 
-    0x00, 0x00, 0x00, 0x00, 0x1f, 0x14, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 
-    0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 
-    0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 
-    0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 
-    0x00, 0x01, 0x07, 0xc1, 0x00, 0x00, 
-    0x00, 0x02, 0x18, 0x30, 0x80, 0x00, 
-    0x00, 0x02, 0x20, 0x08, 0x80, 0x00, 
-    0x00, 0x04, 0x40, 0x04, 0x40, 0x00, 
-    0x00, 0x04, 0x80, 0x02, 0x40, 0x00, 
-    0x00, 0x08, 0x80, 0x02, 0x20, 0x00, 
-    0x01, 0x09, 0x00, 0x01, 0x21, 0x00, 
-    0x03, 0x09, 0x00, 0x01, 0x21, 0x80, 
-    0x07, 0xe9, 0x00, 0x01, 0x2f, 0xc0, 
-    0x03, 0x09, 0x00, 0x01, 0x21, 0x80, 
-    0x01, 0x09, 0x00, 0x01, 0x21, 0x00, 
-    0x00, 0x08, 0x80, 0x02, 0x20, 0x00, 
-    0x00, 0x04, 0x80, 0x02, 0x40, 0x00, 
-    0x00, 0x04, 0x40, 0x04, 0x40, 0x00, 
-    0x00, 0x02, 0x20, 0x08, 0x80, 0x00, 
-    0x00, 0x02, 0x18, 0x30, 0x80, 0x00, 
-    0x00, 0x01, 0x07, 0xc1, 0x00, 0x00, 
-    0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 
-    0x00, 0x00, 0x30, 0x18, 0x00, 0x00, 
-    0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+// control_joystick: 84x48, 310 bytes (504 unencoded)
+const unsigned char control_joystick_data[310] = {
+    0x80, 0x00, 0x08, 0x28, 0x44, 0x54, 0x28, 0x00, 0x7C, 0x44, 0x44, 0x38, 
+    0x80, 0x00, 0x1D, 0x38, 0x44, 0x44, 0x28, 0x00, 0x78, 0x14, 0x14, 0x78, 
+    0x00, 0x7C, 0x08, 0x10, 0x08, 0x7C, 0x00, 0x7C, 0x54, 0x54, 0x44, 0x00, 
+    0x7C, 0x14, 0x34, 0x48, 0x00, 0x78, 0x14, 0x14, 0x78, 0x8E, 0x00, 0x02, 
+    0x80, 0xC0, 0x80, 0x93, 0x00, 0x27, 0x1F, 0x05, 0x0D, 0x12, 0x00, 0x0E, 
+    0x11, 0x11, 0x0E, 0x00, 0x01, 0x01, 0x1F, 0x01, 0x01, 0x00, 0x1E, 0x05, 
+    0x05, 0x1E, 0x00, 0x01, 0x01, 0x1F, 0x01, 0x01, 0x00, 0x11, 0x1F, 0x11, 
+    0x00, 0x0E, 0x11, 0x11, 0x0E, 0x00, 0x1F, 0x02, 0x04, 0x1F, 0x8A, 0x00, 
+    0x0E, 0x80, 0x80, 0x40, 0x40, 0x20, 0x21, 0x21, 0x2F, 0x21, 0x21, 0x20, 
+    0x40, 0x40, 0x80, 0x80, 0x8F, 0x00, 0x0B, 0x80, 0x00, 0x80, 0x40, 0x40, 
+    0x00, 0x00, 0xC0, 0x20, 0x50, 0x88, 0x88, 0x86, 0x04, 0x0B, 0x08, 0x88, 
+    0x50, 0x20, 0xC0, 0x00, 0x00, 0x40, 0x40, 0x80, 0x00, 0x80, 0x85, 0x00, 
+    0x01, 0x80, 0xC0, 0x81, 0x00, 0x08, 0xE0, 0x18, 0x06, 0xC1, 0x30, 0x08, 
+    0x04, 0x02, 0x02, 0x82, 0x01, 0x08, 0x02, 0x02, 0x04, 0x08, 0x30, 0xC1, 
+    0x06, 0x18, 0xE0, 0x81, 0x00, 0x01, 0xC0, 0x80, 0x85, 0x00, 0x02, 0x03, 
+    0x03, 0x02, 0x82, 0x00, 0x04, 0x01, 0x82, 0x84, 0x44, 0xF8, 0x84, 0x08, 
+    0x04, 0xF8, 0x44, 0x84, 0x82, 0x01, 0x82, 0x00, 0x02, 0x02, 0x03, 0x03, 
+    0x84, 0x00, 0x02, 0x01, 0x03, 0x07, 0x80, 0x01, 0x09, 0x00, 0x0F, 0x30, 
+    0xC0, 0x07, 0x18, 0x20, 0x40, 0x80, 0x80, 0x82, 0x00, 0x09, 0x80, 0x80, 
+    0x40, 0x20, 0x18, 0x07, 0xC0, 0x30, 0x0F, 0x00, 0x80, 0x01, 0x02, 0x07, 
+    0x03, 0x01, 0x89, 0x00, 0x03, 0x70, 0x8C, 0x02, 0x01, 0x81, 0x00, 0x01, 
+    0x01, 0x00, 0x80, 0x02, 0x01, 0x00, 0x01, 0x81, 0x00, 0x03, 0x01, 0x02, 
+    0x8C, 0x70, 0x93, 0x00, 0x10, 0x01, 0x02, 0x02, 0x04, 0x04, 0x08, 0x09, 
+    0x09, 0xE9, 0x09, 0x09, 0x08, 0x04, 0x04, 0x02, 0x02, 0x01, 0x95, 0x00, 
+    0x01, 0x01, 0x01, 0x80, 0x02, 0x86, 0x04, 0x80, 0x02, 0x01, 0x01, 0x01, 
+    0x9B, 0x00, 0x04, 0x01, 0x03, 0x07, 0x03, 0x01, 0x8F, 0x00
 };
+const Sprite control_joystick = {84, 48, SPRITE_RLE, control_joystick_data};
 
 #endif
\ No newline at end of file
@@ -0,0 +1,193 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define FIXED_FRAC_BITS 16
+#define FIXED_ONE 65536
+#define FIXED_RAW_MAX 0x7FFFFFFF
+#define FIXED_RAW_MIN (-0x7FFFFFFF - 1)
+
+/*
+    Q16.16 signed fixed-point number
+
+    The LPC1768 has no FPU, so every float operation is a library call.
+    Fixed keeps 16 integer and 16 fractional bits in an int32_t, which turns
+    additions into single instructions and multiplications into a 32x32->64
+    multiply (SMULL) and a shift. Division saturates instead of trapping.
+*/
+class Fixed
+{
+public:
+    Fixed() : _raw(0) {}
+    Fixed(int value) : _raw(value * FIXED_ONE) {}
+    Fixed(float value) : _raw(floatToRaw(value)) {}
+    Fixed(double value) : _raw(doubleToRaw(value)) {}
+
+    static Fixed fromRaw(int32_t raw)
+    {
+        Fixed out;
+        out._raw = raw;
+        return out;
+    }
+
+    int32_t raw() const
+    {
+        return _raw;
+    }
+
+    // addition and subtraction wrap, so a sum of large terms that cancel
+    // out (e.g. across a steep face) still gives the right result
+    friend Fixed operator+(const Fixed& a, const Fixed& b) {
+        return fromRaw((int32_t)((uint32_t)a._raw + (uint32_t)b._raw));
+    }
+
+    friend Fixed operator-(const Fixed& a, const Fixed& b) {
+        return fromRaw((int32_t)((uint32_t)a._raw - (uint32_t)b._raw));
+    }
+
+    friend Fixed operator-(const Fixed& a) {
+        return fromRaw(-a._raw);
+    }
+
+    friend Fixed operator*(const Fixed& a, const Fixed& b) {
+        return fromRaw((int32_t)(((int64_t)a._raw * b._raw) >> FIXED_FRAC_BITS));
+    }
+
+    friend Fixed operator/(const Fixed& a, const Fixed& b) {
+        if (b._raw == 0) {
+            return fromRaw(a._raw < 0 ? FIXED_RAW_MIN : FIXED_RAW_MAX);
+        }
+        int64_t q = ((int64_t)a._raw * FIXED_ONE) / b._raw;
+        if (q > FIXED_RAW_MAX) {
+            q = FIXED_RAW_MAX;
+        } else if (q < FIXED_RAW_MIN) {
+            q = FIXED_RAW_MIN;
+        }
+        return fromRaw((int32_t)q);
+    }
+
+    Fixed& operator+=(const Fixed& b) { *this = *this + b; return *this; }
+    Fixed& operator-=(const Fixed& b) { *this = *this - b; return *this; }
+    Fixed& operator*=(const Fixed& b) { *this = *this * b; return *this; }
+    Fixed& operator/=(const Fixed& b) { *this = *this / b; return *this; }
+
+    friend bool operator==(const Fixed& a, const Fixed& b) { return a._raw == b._raw; }
+    friend bool operator!=(const Fixed& a, const Fixed& b) { return a._raw != b._raw; }
+    friend bool operator<(const Fixed& a, const Fixed& b)  { return a._raw < b._raw; }
+    friend bool operator>(const Fixed& a, const Fixed& b)  { return a._raw > b._raw; }
+    friend bool operator<=(const Fixed& a, const Fixed& b) { return a._raw <= b._raw; }
+    friend bool operator>=(const Fixed& a, const Fixed& b) { return a._raw >= b._raw; }
+
+private:
+    // converts an IEEE-754 single to Q16.16 using integer operations only,
+    // rounding to nearest (halves away from zero, as doubleToRaw) and
+    // saturating out of range values
+    static int32_t floatToRaw(float value)
+    {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        int exponent = (int)((bits >> 23) & 0xFF) - 127;
+        if (exponent < -FIXED_FRAC_BITS - 1) {
+            return 0;  // less than half of the smallest step
+        }
+        if (exponent >= 15) {
+            return (bits >> 31) ? FIXED_RAW_MIN : FIXED_RAW_MAX;
+        }
+        // value = mantissa * 2^(exponent - 23), raw = value * 2^16
+        int32_t mantissa = (bits & 0x7FFFFF) | 0x800000;
+        int shift = exponent - 7;
+        int32_t magnitude = shift >= 0 ? mantissa << shift
+                                       : (mantissa + (1 << (-shift - 1))) >> -shift;
+        return (bits >> 31) ? -magnitude : magnitude;
+    }
+
+    // rounds to nearest, halves away from zero, and saturates like floatToRaw
+    static int32_t doubleToRaw(double value)
+    {
+        double scaled = value * FIXED_ONE + (value < 0 ? -0.5 : 0.5);
+        if (scaled >= 2147483647.0) {
+            return FIXED_RAW_MAX;
+        }
+        if (scaled <= -2147483648.0) {
+            return FIXED_RAW_MIN;
+        }
+        return (int32_t)scaled;
+    }
+
+    int32_t _raw;
+};
+
+
+// integer part, truncated towards zero like a float to int cast
+inline int toInt(Fixed value)
+{
+    int32_t raw = value.raw();
+    return raw >= 0 ? raw >> FIXED_FRAC_BITS : -((-raw) >> FIXED_FRAC_BITS);
+}
+
+inline float toFloat(Fixed value)
+{
+    return value.raw() / (float)FIXED_ONE;
+}
+
+// integer square root of a 64 bit value (bit by bit, no division)
+inline uint32_t isqrt64(uint64_t value)
+{
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+inline Fixed sqrt(Fixed value)
+{
+    if (value.raw() <= 0) {
+        return Fixed();
+    }
+    return Fixed::fromRaw(isqrt64((uint64_t)value.raw() << FIXED_FRAC_BITS));
+}
+
+// product as a 64 bit raw value that doesn't wrap, for sums of terms that
+// can be outside of the Q16.16 range
+inline int64_t mulWide(Fixed a, Fixed b)
+{
+    return ((int64_t)a.raw() * b.raw()) >> FIXED_FRAC_BITS;
+}
+
+// a 64 bit raw value, saturated to the Q16.16 range
+inline Fixed saturate(int64_t raw)
+{
+    if (raw > FIXED_RAW_MAX) {
+        return Fixed::fromRaw(FIXED_RAW_MAX);
+    }
+    if (raw < FIXED_RAW_MIN) {
+        return Fixed::fromRaw(FIXED_RAW_MIN);
+    }
+    return Fixed::fromRaw((int32_t)raw);
+}
+
+// length of a 3D vector, the squares are summed in 64 bits as they overflow
+// Q16.16 for components above 181
+inline Fixed length3(Fixed x, Fixed y, Fixed z)
+{
+    uint64_t sum = (uint64_t)((int64_t)x.raw() * x.raw())
+                 + (uint64_t)((int64_t)y.raw() * y.raw())
+                 + (uint64_t)((int64_t)z.raw() * z.raw());
+    uint32_t length = isqrt64(sum);
+    return Fixed::fromRaw(length > FIXED_RAW_MAX ? FIXED_RAW_MAX : length);
+}
+
+#endif
@@ -10,10 +10,11 @@
 #include "Utils.h"
 #include "Game.h"
 #include "Object.h"
+#include "Solver.h"
 
 Game::Game()
         :
-        _tile_list(),
+        _level(),
         _elapsed_secs(),
         _display_secs(),
         _counter(),
@@ -23,19 +24,21 @@ Game::Game()
         _scale(),
         
         _loc_index(),
-        _rot_index()
+        _rot_index(),
+        _solver(),
+        _solvable(SOLVE_UNKNOWN)
 {}
 
 
-const Vector3 verts[8] = {{-1.0, -1.0, -1.0}, {-1.0, -1.0, 1.0}, {-1.0, 1.0, -1.0}, {-1.0, 1.0, 1.0}, {1.0, -1.0, -1.0}, {1.0, -1.0, 1.0}, {1.0, 1.0, -1.0}, {1.0, 1.0, 1.0}};
+const Vertex verts[8] = {{-1.0, -1.0, -1.0}, {-1.0, -1.0, 1.0}, {-1.0, 1.0, -1.0}, {-1.0, 1.0, 1.0}, {1.0, -1.0, -1.0}, {1.0, -1.0, 1.0}, {1.0, 1.0, -1.0}, {1.0, 1.0, 1.0}};
 const unsigned short faces[6][4] = {{0, 1, 3, 2}, {2, 3, 7, 6}, {6, 7, 5, 4}, {4, 5, 1, 0}, {2, 6, 4, 0}, {7, 3, 1, 5}};
 
-ObjData cube_object = {verts, faces[0], 6};
+ObjData cube_object = {verts, 8, faces[0], 6, 1.733};
 
-const Vector3 verts3[20] = {{-1.0, 1.0, 1.0}, {-1.0, 1.0, -1.0}, {-1.0, -1.0, 1.0}, {-1.0, -1.0, -1.0}, {1.0, 1.0, 1.0}, {1.0, 1.0, -1.0}, {1.0, -1.0, 1.0}, {1.0, -1.0, -1.0}, {-1.0, 1.0, 0.3333333333333333}, {-1.0, 1.0, -0.3333333333333333}, {1.0, 1.0, -0.3333333333333333}, {1.0, 1.0, 0.3333333333333333}, {-0.3333333333333333, 1.0, 1.0}, {0.3333333333333333, 1.0, 1.0}, {0.3333333333333333, 1.0, -1.0}, {-0.3333333333333333, 1.0, -1.0}, {0.3333333333333333, 1.0, 0.3333333333333333}, {-0.3333333333333333, 1.0, 0.3333333333333333}, {0.3333333134651184, 1.0, -0.3333330750465393}, {-0.33333325386047363, 1.0, -0.3333330750465393}};
+const Vertex verts3[20] = {{-1.0, 1.0, 1.0}, {-1.0, 1.0, -1.0}, {-1.0, -1.0, 1.0}, {-1.0, -1.0, -1.0}, {1.0, 1.0, 1.0}, {1.0, 1.0, -1.0}, {1.0, -1.0, 1.0}, {1.0, -1.0, -1.0}, {-1.0, 1.0, 0.3333333333333333}, {-1.0, 1.0, -0.3333333333333333}, {1.0, 1.0, -0.3333333333333333}, {1.0, 1.0, 0.3333333333333333}, {-0.3333333333333333, 1.0, 1.0}, {0.3333333333333333, 1.0, 1.0}, {0.3333333333333333, 1.0, -1.0}, {-0.3333333333333333, 1.0, -1.0}, {0.3333333333333333, 1.0, 0.3333333333333333}, {-0.3333333333333333, 1.0, 0.3333333333333333}, {0.3333333134651184, 1.0, -0.3333330750465393}, {-0.33333325386047363, 1.0, -0.3333330750465393}};
 const unsigned short faces3[1][4] = {{0, 1, 5, 4}};
 
-ObjData game_space_object = {verts3, faces3[0], 1};
+ObjData game_space_object = {verts3, 20, faces3[0], 1, 1.733};
 
 // initialise global variables
 unsigned int game_space = 0;
@@ -78,165 +81,58 @@ bool Game::getSpaceBit(int input_space, int i, int j, int k)
 }
 
 
-// this function will translate a 3x3x3 game space by i, j, k
-int Game::translateSpace(int input_space, int i, int j, int k)
+// returns the filled cells of a game space whose given cube face (in the order
+// of the faces array) is not covered by a filled neighbouring cell. The
+// neighbours are found by shifting the whole space by one cell towards the
+// face, masking out the cells that would wrap onto the next row
+int Game::exposedSpace(int input_space, int face)
 {
-    int output_space = input_space;
-    for(int n = 0; n < i; n++){
-        // translate by 1 bit in x direction
-        output_space = (output_space & 0x6DB6DB6) >> 1;
+    int neighbours = 0;
+    switch(face){
+        case 0: // -x
+            neighbours = input_space >> 9;
+            break;
+        case 1: // +y
+            neighbours = (input_space & 0x36DB6DB) << 1;
+            break;
+        case 2: // +x
+            neighbours = (input_space << 9) & 0x7FFFFFF;
+            break;
+        case 3: // -y
+            neighbours = (input_space & 0x6DB6DB6) >> 1;
+            break;
+        case 4: // -z
+            neighbours = (input_space & 0x7E3F1F8) >> 3;
+            break;
+        case 5: // +z
+            neighbours = (input_space & 0x0FC7E3F) << 3;
+            break;
     }
-    for(int n = 0; n < j; n++){
-        // translate by 1 bit in y direction
-        output_space = (output_space & 0x7E3F1F8) >> 3;
-    }
-    for(int n = 0; n < k; n++){
-        // translate by 1 bit in z direction
-        output_space = output_space >> 9;
-    }
-    return output_space;
+    return input_space & ~neighbours;
 }
 
 
-// this function rotates a tile by i, j and k
-// the function rotates both the encoded int representation of the shape of the
-// tile, AND the size of the tile
-Tile Game::rotateSpace(Tile input_tile, int i, int j, int k)
+// returns all possible positions for an orientation of a tile piece in the
+// current game space
+PlacementList Game::validTranslations(const Orientation &orientation)
 {
-    Tile output = input_tile;
-    int temp = 0; // variable to store intermediate rotations
-    
-    // rotation in  about the x axis
-    for(int n = 0; n < i; n++){
-        int temp0 = output.size[0];
-        output.size[0] = output.size[1];
-        output.size[1] = temp0;
-        
-        for(int b = 0; b < 27; b++){
-            // the formula below rearranges bit at index b to index b'
-            // corrisponding to a rotation
-            temp |= ((output.shape & (0x4000000 >> b)) << b) 
-                    >> ((2-((b%9)/3)) + ((b%3)*3) + (9*(b/9)));
-        }
-        output.shape = temp;
-        temp = 0;
-    }
-    
-    // rotation in  about the y axis
-    for(int n = 0; n < j; n++){
-        int temp1 = output.size[1];
-        output.size[1] = output.size[2];
-        output.size[2] = temp1;
-        
-        for(int b = 0; b < 27; b++){
-            // bit-wise rotation formula for y axis
-            temp |= ((output.shape & (0x4000000 >> b)) << b) 
-                    >> b + (6*((-2*(b/9)) + ((b%9)/3)+1));
-        }
-        output.shape = temp;
-        temp = 0;
-    }
-    
-    // rotation in  about the z axis
-    for(int n = 0; n < k; n++){
-        int temp2 = output.size[2];
-        output.size[2] = output.size[0];
-        output.size[0] = temp2;
-        
-        for(int b = 0; b < 27; b++){
-            // bit-wise rotation formula for z axis
-            temp |= ((output.shape & (0x4000000 >> b)) << b) 
-                    >> b + ((9*(2-(b/9) - (b%3))) + (b/9) - (b%3));
-        }
-        output.shape = temp;
-        temp = 0;
-    }
-    return output;
+    return findPlacements(orientation, game_space);
 }
 
 
-// returns all possible positions for the tile piece in a variable length vector
-// for any given tile and the current game space
-vector<int> Game::validTranslations(Tile input_tile)
+// Returns a list of all valid rotations for a kind of tile in the current game space
+// the distinct orientations of each tile kind are looked up in the tables
+// generated by host/OrientationGen.cpp, only their placements depend on the game space
+RotationList Game::validRotations(int kind)
 {
-    unsigned int tile_game_space = 0;
-    int attempt_loc[3] = {0};
-    vector<int> pos_list;
+    RotationList rot_list;
+    rot_list.count = 0;
+    const TileOrientations &orientations = tile_orientations[kind];
     
-    // for all possible locations given the size constraint
-    for(int i = 0; i < (4-input_tile.size[1])*(4-input_tile.size[2]); i++){
-        
-        // get the location of the current attempt
-        int operand = 4 - input_tile.size[1];
-        attempt_loc[0] = 4 - input_tile.size[0];
-        attempt_loc[1] = (int)(i%operand);
-        attempt_loc[2] = (int)(i/operand);
-        
-        int collision_count = 1;
-        while(collision_count != 0 && attempt_loc[0] > 0){
-            attempt_loc[0] -= 1;
-            
-            // set tile_game_space to have tile in it at relative location
-            tile_game_space = translateSpace(input_tile.shape, attempt_loc[0], attempt_loc[1], attempt_loc[2]);
-            collision_count = tile_game_space & game_space; // detect collisions
-        }
-        if(collision_count == 0){
-            int n = translateSpace(input_tile.shape, attempt_loc[0], attempt_loc[1], attempt_loc[2]);
-            pos_list.push_back(n);
-        }
-    }
-    return pos_list;
-}
-
-
-// Returns a list of all valid tile rotations for a given tile in the current game space
-vector<Tile> Game::validRotations(Tile input_tile)
-{
-    vector<Tile> rot_list;
-    
-    const int all_rot[24][3] =  {{0,0,0},{0,0,1},{0,0,2},{0,0,3},
-                           {1,0,0},{1,0,1},{1,0,2},{1,0,3},
-                           {2,0,0},{2,0,1},{2,0,2},{2,0,3},
-                           {3,0,0},{3,0,1},{3,0,2},{3,0,3},
-                           {0,1,0},{0,1,1},{0,1,2},{0,1,3},
-                           {0,3,0},{0,3,1},{0,3,2},{0,3,3}};
-    
-    for(int i = 0; i < 24; i++){
-        
-        // [NOTE 1] replacing this code with a check of x row, y row and z row
-        // for any 2 or more coincidenceshence allows the removal of the 'size'
-        // from the Tile struct
-        
-        Tile convex_hull;
-        convex_hull.shape = 0x4000000;
-        
-        // create convex hull shape (minimum bounding box)
-        for(int b = 0; b < input_tile.size[0]-1; b++){
-            convex_hull.shape |= convex_hull.shape >> 1;
-        }
-        for(int b = 0; b < input_tile.size[1]-1; b++){
-            convex_hull.shape |= convex_hull.shape >> 3;
-        }
-        for(int b = 0; b < input_tile.size[2]-1; b++){
-            convex_hull.shape |= convex_hull.shape >> 9;
-        }
-        
-        Tile valid_tile = rotateSpace(input_tile, all_rot[i][0], all_rot[i][1], all_rot[i][2]);
-        convex_hull = rotateSpace(convex_hull, all_rot[i][0], all_rot[i][1], all_rot[i][2]);
-        valid_tile.shape = valid_tile.shape << (__clz(convex_hull.shape)-5); // Move to 0,0,0 corner
-        
+    for(int i = 0; i < orientations.count; i++){
         // check if there are valid locations for the tile
-        if(validTranslations(valid_tile).size() > 0){
-            // remove identical rotations cause by the symmetry of the tile shape
-            bool duplicate_check = 0;
-            for(int n = 0; n < rot_list.size(); n++){
-                if(rot_list[n].shape == valid_tile.shape){
-                    duplicate_check = 1;
-                }
-            }
-            if(duplicate_check == 0){
-                rot_list.push_back(valid_tile);
-            }
+        if(validTranslations(orientations.orientations[i]).count > 0){
+            rot_list.orientations[rot_list.count++] = &orientations.orientations[i];
         }
     }
     return rot_list;
@@ -251,10 +147,9 @@ void Game::setNewRotation(Quaternion rotation)
 
 
 // initialises all variable to their default values at the beginning of a game
-void Game::init(vector<Tile> tile_list)
+void Game::init(const Level &level)
 {
-    _tile_list.clear();
-    _tile_list = tile_list;
+    _level = level; // the tiles stay in flash
     
     // variables used to calculate fps
     _elapsed_secs = 0;
@@ -278,23 +173,85 @@ void Game::init(vector<Tile> tile_list)
     Cube.setObjData(cube_object);
     GameSpace.setObjData(game_space_object);
 
-    _valid_rotations = validRotations(_tile_list[0]);
-    _valid_loc = validTranslations(_tile_list[0]);
-    
     _tile_count = 0;
     _loc_index = 0;
     _rot_index = 0;
-    game_space = 0;
+    game_space = 0; // cleared first, the placements depend on it
+    
+    _valid_rotations.count = 0;
+    if(!_level.empty()){ // a level that hasn't been designed can't be played
+        _valid_rotations = validRotations(_level[0]);
+    }
+    updatePlacements();
+    
+    _solver.reset();
+    _solver.start(game_space, _level, _tile_count, GAME_SOLVER_BUDGET);
+    _solvable = SOLVE_SEARCHING;
+}
+
+
+// returns whether the level can still be won from the current game space, as
+// found after the last move (SOLVE_UNKNOWN if the search ran out of its budget,
+// SOLVE_SEARCHING until the search has finished)
+SolveResult Game::getSolvable()
+{
+    return _solvable;
+}
+
+
+// returns the game space mask of a placement of the current tile that keeps
+// the level winnable, or 0 if none is known
+int Game::getHint()
+{
+    return _solvable == SOLVE_SOLVABLE ? _solver.getHint():0;
+}
+
+
+// finds the positions of the selected rotation of the current tile
+void Game::updatePlacements()
+{
+    _valid_loc.count = 0;
+    if(_valid_rotations.count > 0){
+        _valid_loc = validTranslations(*_valid_rotations.orientations[(unsigned int)_rot_index % _valid_rotations.count]);
+    }
+}
+
+
+// selects the rotation and position of the current tile given by getHint,
+// if there is one
+void Game::selectHint()
+{
+    int const hint = getHint();
+    if(hint == 0){
+        return;
+    }
+    for(int rot = 0; rot < _valid_rotations.count; rot++){
+        PlacementList pos_list = validTranslations(*_valid_rotations.orientations[rot]);
+        for(int n = 0; n < pos_list.count; n++){
+            if(pos_list.masks[n] == hint){
+                _rot_index = rot;
+                _loc_index = n;
+                _valid_loc = pos_list;
+                return;
+            }
+        }
+    }
 }
 
 
-// Draws the tile list on the right of the screen
+// Draws the tile list on the right of the screen, with a mark above it that is
+// filled once a hint is known and an outline while the solver is searching
 void Game::drawTileList()
 {
     lcd.drawRect(71,5,12,38,FILL_TRANSPARENT);
+    if(_solvable == SOLVE_SOLVABLE){
+        lcd.drawRect(76,1,3,3,FILL_BLACK);
+    }else if(_solvable == SOLVE_SEARCHING){
+        lcd.drawRect(76,1,3,3,FILL_TRANSPARENT);
+    }
     
-    for(int index = 0; index < min((int)(_tile_list.size()-_tile_count-1), 4); index++){
-        Tile tile2draw = _tile_list[index+_tile_count+1];
+    for(int index = 0; index < min((int)_level.size()-_tile_count-1, 4); index++){
+        Tile tile2draw = tile_orientations[_level[index+_tile_count+1]].tile;
         for(int n = 0; n < 9; n++){
             if(getSpaceBit(tile2draw.shape, 0, n/3, n%3)){
                 lcd.drawRect((n/3)*2+74+(3-tile2draw.size[1]),
@@ -311,7 +268,13 @@ int Game::getFrame()
     clock_t begin = clock(); // begin the timer
     _counter++; // increment frame counter
     int status = 0;
-        
+    
+    // A and C together would cancel out, so they select the hinted placement
+    if (_buttonA_flag == 1 && _buttonC_flag == 1){
+        _buttonA_flag = 0;
+        _buttonC_flag = 0;
+        selectHint();
+    }
     if (_buttonA_flag == 1){
         _buttonA_flag = 0;
         _loc_index += 1;
@@ -329,62 +292,99 @@ int Game::getFrame()
 
     // if a new rotation is requested
     if(_buttonB_flag == 1 || _buttonD_flag == 1){
-        _valid_loc = validTranslations(_valid_rotations[_rot_index % _valid_rotations.size()]);
+        updatePlacements();
         _buttonB_flag = 0;
         _buttonD_flag = 0;
     }
     
-    _rot_index = _rot_index >= 0 ? _rot_index:_valid_rotations.size()-1;
-    _loc_index = _loc_index >= 0 ? _loc_index:_valid_loc.size()-1;
+    _rot_index = _rot_index >= 0 ? _rot_index:_valid_rotations.count-1;
+    _loc_index = _loc_index >= 0 ? _loc_index:_valid_loc.count-1;
     
     unsigned int tile_game_space = 0;
-    if(_valid_rotations.size() > 0){
-        tile_game_space = _valid_loc[_loc_index % _valid_loc.size()];
+    if(_valid_rotations.count > 0){
+        tile_game_space = _valid_loc.masks[_loc_index % _valid_loc.count];
     }else if(game_space == 0x7FFFFFF){
         status = WIN;
     }else{
         status = LOSE;
     }
+    if(_solvable == SOLVE_DEAD){
+        status = LOSE; // the tiles that are left can't fill the game space
+    }
     
     if (_buttonJ_flag == 1)
     {
         game_space |= tile_game_space;
         //_rot_index = 0;
         //_loc_index = 0;
-        if(_tile_count < _tile_list.size()-1){
+        if(_tile_count < (int)_level.size()-1){
             _tile_count++;
         }
-        _valid_rotations = validRotations(_tile_list[_tile_count]);
-        _valid_loc = validTranslations(_valid_rotations[_rot_index % _valid_rotations.size()]);
+        if(!_level.empty()){
+            _valid_rotations = validRotations(_level[_tile_count]);
+        }
+        updatePlacements();
+        _solver.start(game_space, _level, _tile_count, GAME_SOLVER_BUDGET);
+        _solvable = SOLVE_SEARCHING;
         _buttonJ_flag = 0;
     }
     
+    if(_solvable == SOLVE_SEARCHING){
+        _solvable = _solver.run(GAME_SOLVER_SLICE_US);
+    }
+    
     lcd.clear();  // clear the lcd
+    // the depth range covers the grid (the corner cubes' centres are 2*sqrt(3)
+    // cube radii out) and the game space frame, at their scales below
+    Real const grid_radius = (Cube.getRadius() + Real(3.4641f)) * _scale.x / 6;
+    Real const frame_radius = GameSpace.getRadius() * _scale.x / Real(1.9f);
+    Real const radius = max(grid_radius, frame_radius);
+    setDepthRange(-radius, radius);
     clearDepth(); // clear the depth buffer
     
-    // draws the fixed game space and current tile on the lcd using the 3D engine
+    // faces between two drawn cubes can never be seen, so only the faces on
+    // the outside of the drawn cells are drawn
+    int exposed[6];
+    for(int face = 0; face < 6; face++){
+        exposed[face] = exposedSpace(game_space | tile_game_space, face);
+    }
+    
+    // draws the fixed game space and current tile on the lcd using the 3D engine,
+    // all of the cubes share a rotation and scale so they are drawn as instances
+    Instance cubes[27];
+    int cube_count = 0;
     for(int i = 0; i <= 2; i++){
         for(int j = 0; j <= 2; j++){
             for(int k = 0; k <= 2; k++){
                 Vector3 relative_loc = {(-i+1)*2, (k-1)*2, (j-1)*2};
                 
+                unsigned int face_mask = 0;
+                for(int face = 0; face < 6; face++){
+                    face_mask |= getSpaceBit(exposed[face], 2-i, j, k) << face;
+                }
+                
                 if(getSpaceBit(game_space, 2-i, j, k)  == 1)
                 {
                     // if the game space if filled (== 1) then draw a white cube
-                    Cube.setLocRotScale(_location, relative_loc, _rotation, _scale/6.0);
-                    Cube.draw(FILL_WHITE);
+                    cubes[cube_count].relative_location = relative_loc;
+                    cubes[cube_count].face_mask = face_mask;
+                    cubes[cube_count++].fill = FILL_WHITE;
                 }
                 else if(getSpaceBit(tile_game_space, 2-i, j, k) == 1)
                 {
                     // if the tile space if filled (== 1) then draw a black cube
-                    Cube.setLocRotScale(_location, relative_loc, _rotation, _scale/6.0);
-                    Cube.draw(FILL_BLACK);
+                    cubes[cube_count].relative_location = relative_loc;
+                    cubes[cube_count].face_mask = face_mask;
+                    cubes[cube_count++].fill = FILL_BLACK;
                 }
             }
         }
     }
     
     Vector3 relative_loc = {0,0,0};
+    Cube.setLocRotScale(_location, relative_loc, _rotation, _scale/6.0);
+    Cube.drawInstances(cubes, cube_count);
+    
     Vector3 scale_factor = {1.90, 1.90, 2.0};
     GameSpace.setLocRotScale(_location, relative_loc, _rotation, _scale/scale_factor);
     GameSpace.draw(FILL_WHITE);
@@ -7,14 +7,29 @@
 #include "N5110.h"
 #include "Utils.h"
 #include "Object.h"
+#include "Solver.h"
 //using std::vector;
 
+// positions the solver may search after each move to find whether the level can
+// still be won, a search that runs out is retried after the next move
+#define GAME_SOLVER_BUDGET 2000
+
+// microseconds of each frame given to the search, it carries on over as many
+// frames as it needs so that a move never holds up the frame that shows it
+#define GAME_SOLVER_SLICE_US 4000
+
+
+// the orientations of a tile that can be placed in the game space
+struct RotationList{
+    unsigned char count;
+    const Orientation *orientations[24];
+};
 
 class Game
 {
 public:
     Game();
-    void init(vector<Tile> tile_list);
+    void init(const Level &level);
     int getFrame();
     
     void setNewRotation(Quaternion rotation);
@@ -25,17 +40,21 @@ public:
     void setButtonCflag(bool buttonC_flag);
     void setButtonDflag(bool buttonD_flag);
     void setButtonJflag(bool buttonJ_flag);
+    
+    SolveResult getSolvable();
+    int getHint();
 
 private:
     bool getSpaceBit(int input_space, int i, int j, int k);
-    int translateSpace(int input_space, int i, int j, int k);
-    Tile rotateSpace(Tile input_tile, int i, int j, int k);
-    vector<int> validTranslations(Tile input_tile);
-    vector<Tile> validRotations(Tile input_tile);
+    int exposedSpace(int input_space, int face);
+    PlacementList validTranslations(const Orientation &orientation);
+    RotationList validRotations(int kind);
+    void updatePlacements();
+    void selectHint();
     void print(double val, int row);
     void drawTileList();
     
-    vector<Tile> _tile_list;
+    Level _level;
     double _elapsed_secs;
     double _display_secs;
     volatile int _counter;
@@ -47,14 +66,17 @@ private:
     
     //Tile _test_tile;
     
-    vector<Tile> _valid_rotations;
-    vector<int> _valid_loc;
+    RotationList _valid_rotations;
+    PlacementList _valid_loc;
     
     short _tile_count;
     
     short _loc_index;
     short _rot_index;
     
+    Solver _solver;
+    SolveResult _solvable;
+    
     bool _buttonA_flag;
     bool _buttonB_flag;
     bool _buttonC_flag;
@@ -0,0 +1,89 @@
+/*
+    Level catalogue
+    The tiles of each level in the order they are placed, kept in flash so
+    that a level can be selected without building a list of its tiles
+
+    Generated by host/LevelGen.cpp (levelgen --seed 1 --candidates 400 --orders 3
+    --max-states 131072 --tiles 6-8 --min-solutions 1 --max-solutions 20000).
+    Levels 0-7 are designed by hand: edit them here and run make levels to
+    check them.
+    Difficulty is -log2 of the chance that random moves win the level
+*/
+
+#include "Utils.h"
+
+// 11 tiles, 54923936 solutions, branching 8.8, difficulty 4.8 (1 in 27 random games won)
+const TileKind level0[11] = {TILE_T, TILE_L, TILE_O, TILE_I, TILE_i, TILE_i, TILE_i, TILE_O, TILE_I, TILE_I, TILE_i};
+// 9 tiles, 237608744 solutions, branching 17.9, difficulty 7.7 (1 in 210 random games won)
+const TileKind level1[9] = {TILE_l, TILE_l, TILE_l, TILE_l, TILE_l, TILE_l, TILE_l, TILE_l, TILE_l};
+// 9 tiles, 259496 solutions, branching 8.0, difficulty 6.0 (1 in 64 random games won)
+const TileKind level2[9] = {TILE_I, TILE_T, TILE_l, TILE_I, TILE_L, TILE_T, TILE_l, TILE_l, TILE_l};
+// 7 tiles, 32112 solutions, branching 5.2, difficulty 5.0 (1 in 32 random games won)
+const TileKind level3[7] = {TILE_T, TILE_T, TILE_C, TILE_C, TILE_L, TILE_l, TILE_i};
+// 7 tiles, 1280 solutions, branching 16.3, difficulty 12.0 (1 in 4105 random games won)
+const TileKind level4[7] = {TILE_Z, TILE_Z, TILE_Z, TILE_Z, TILE_I, TILE_C, TILE_I};
+// 7 tiles, 1808 solutions, branching 8.1, difficulty 5.2 (1 in 38 random games won)
+const TileKind level5[7] = {TILE_C, TILE_C, TILE_C, TILE_C, TILE_C, TILE_O, TILE_O};
+// 8 tiles, 5080 solutions, branching 5.9, difficulty 4.1 (1 in 17 random games won)
+const TileKind level6[8] = {TILE_X, TILE_X, TILE_X, TILE_X, TILE_X, TILE_l, TILE_I, TILE_O};
+// 7 tiles, 6536 solutions, branching 7.6, difficulty 7.1 (1 in 136 random games won)
+const TileKind level7[7] = {TILE_Z, TILE_T, TILE_L, TILE_C, TILE_X, TILE_X, TILE_i};
+// 8 tiles, 13296 solutions, branching 4.3, difficulty 4.6 (1 in 24 random games won)
+const TileKind level8[8] = {TILE_I, TILE_I, TILE_T, TILE_I, TILE_C, TILE_I, TILE_I, TILE_l};
+// 7 tiles, 3000 solutions, branching 4.3, difficulty 5.7 (1 in 51 random games won)
+const TileKind level9[7] = {TILE_C, TILE_C, TILE_Z, TILE_X, TILE_T, TILE_Z, TILE_O};
+// 8 tiles, 16840 solutions, branching 6.3, difficulty 6.0 (1 in 66 random games won)
+const TileKind level10[8] = {TILE_i, TILE_X, TILE_C, TILE_X, TILE_C, TILE_i, TILE_I, TILE_i};
+// 7 tiles, 4272 solutions, branching 7.0, difficulty 6.6 (1 in 97 random games won)
+const TileKind level11[7] = {TILE_L, TILE_X, TILE_X, TILE_X, TILE_I, TILE_L, TILE_X};
+// 7 tiles, 10152 solutions, branching 7.9, difficulty 7.0 (1 in 124 random games won)
+const TileKind level12[7] = {TILE_T, TILE_T, TILE_T, TILE_I, TILE_T, TILE_T, TILE_T};
+// 8 tiles, 10576 solutions, branching 5.1, difficulty 7.3 (1 in 161 random games won)
+const TileKind level13[8] = {TILE_I, TILE_T, TILE_Z, TILE_I, TILE_I, TILE_I, TILE_I, TILE_L};
+// 8 tiles, 12920 solutions, branching 5.8, difficulty 7.7 (1 in 202 random games won)
+const TileKind level14[8] = {TILE_I, TILE_L, TILE_C, TILE_I, TILE_I, TILE_I, TILE_I, TILE_I};
+// 7 tiles, 616 solutions, branching 6.6, difficulty 8.0 (1 in 252 random games won)
+const TileKind level15[7] = {TILE_X, TILE_Z, TILE_I, TILE_X, TILE_X, TILE_T, TILE_L};
+// 7 tiles, 2728 solutions, branching 7.0, difficulty 8.5 (1 in 358 random games won)
+const TileKind level16[7] = {TILE_X, TILE_T, TILE_X, TILE_T, TILE_I, TILE_L, TILE_L};
+// 7 tiles, 1456 solutions, branching 8.6, difficulty 8.9 (1 in 485 random games won)
+const TileKind level17[7] = {TILE_O, TILE_C, TILE_C, TILE_Z, TILE_C, TILE_I, TILE_L};
+// 7 tiles, 1568 solutions, branching 7.6, difficulty 9.4 (1 in 696 random games won)
+const TileKind level18[7] = {TILE_T, TILE_T, TILE_C, TILE_O, TILE_C, TILE_T, TILE_T};
+// 7 tiles, 1200 solutions, branching 6.8, difficulty 9.8 (1 in 904 random games won)
+const TileKind level19[7] = {TILE_L, TILE_C, TILE_I, TILE_T, TILE_I, TILE_T, TILE_Z};
+// 7 tiles, 1464 solutions, branching 8.0, difficulty 10.0 (1 in 1057 random games won)
+const TileKind level20[7] = {TILE_X, TILE_T, TILE_T, TILE_X, TILE_T, TILE_l, TILE_T};
+// 7 tiles, 432 solutions, branching 8.1, difficulty 10.7 (1 in 1711 random games won)
+const TileKind level21[7] = {TILE_C, TILE_i, TILE_X, TILE_C, TILE_I, TILE_Z, TILE_Z};
+// 6 tiles, 168 solutions, branching 9.9, difficulty 11.2 (1 in 2317 random games won)
+const TileKind level22[6] = {TILE_C, TILE_Z, TILE_C, TILE_C, TILE_L, TILE_T};
+// 7 tiles, 112 solutions, branching 7.5, difficulty 12.3 (1 in 4882 random games won)
+const TileKind level23[7] = {TILE_I, TILE_T, TILE_I, TILE_C, TILE_T, TILE_Z, TILE_T};
+
+const Level levels[LEVEL_COUNT] = {
+    Level(level0),
+    Level(level1),
+    Level(level2),
+    Level(level3),
+    Level(level4),
+    Level(level5),
+    Level(level6),
+    Level(level7),
+    Level(level8),
+    Level(level9),
+    Level(level10),
+    Level(level11),
+    Level(level12),
+    Level(level13),
+    Level(level14),
+    Level(level15),
+    Level(level16),
+    Level(level17),
+    Level(level18),
+    Level(level19),
+    Level(level20),
+    Level(level21),
+    Level(level22),
+    Level(level23),
+};
@@ -8,7 +8,7 @@
 // Returns the x location required to center align the input string
 int centerAlign(std::string str)
 {
-    return (84-(str.length()*6))/2;
+    return (WIDTH-lcd.stringWidth(str.c_str()))/2;
 }
 
 
@@ -38,15 +38,7 @@ void Menu::set_options(std::string opt1, std::string opt2, std::string opt3)
 // Inverts all the pixels at the specified selected option
 void Menu::drawSelected(int sel)
 {
-    for(int x = 14; x < 70; x++ ) {
-        for(int y = 15 + (sel*8); y < 23 + (sel*8); y++ ) {
-            if(lcd.getPixel(x, y) == 1) {
-                lcd.setPixel(x, y, 0); 
-            }else{
-                lcd.setPixel(x, y, 1);
-            }
-        }
-    }
+    lcd.invertRect(14, 15 + (sel*8), 56, 8);
 }
 
 
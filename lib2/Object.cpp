@@ -16,7 +16,9 @@
 
 Object::Object()
         :
-         _faces_len()
+         _faces_len(),
+         _radius(),
+         _instance_offset()
 
 {}
 
@@ -24,14 +26,84 @@ Object::Object()
 
 Vector3 g_face_normal;
 volatile unsigned char fill_buffer[84][6];  // pixel buffer used to determine the inside area of faces
-float depth_buffer[84][48] = {{-INFINITY}}; // pixel depth buffer
+DepthValue depth_buffer[84][48]; // quantised pixel depth buffer (larger is closer)
+
+// vertices of the object being drawn in screen space, shared by all of its faces.
+// A vertex is transformed the first time a face uses it in each draw and
+// flagged in transformed_flags (one bit per vertex)
+Vector3 transformed_verts[MAX_VERTS];
+unsigned int transformed_flags[(MAX_VERTS + 31) / 32];
+
+// furthest depth buffer value in each 8 pixel band of a column (one lcd bank),
+// a face span that is no closer than this is hidden behind the band
+DepthValue depth_band_min[84][6];
+
+// faces of the object being drawn, sorted front to back by sortFaces
+unsigned short face_order[MAX_FACES];
+unsigned char face_keys[MAX_FACES];
+unsigned short face_bucket_start[256];
+
+// face depths are sorted on the 8 most significant bits of the depth value
+#ifdef DEPTH_BUFFER_8BIT
+#define DEPTH_BUCKET_SHIFT 0
+#else
+#define DEPTH_BUCKET_SHIFT 7
+#endif
+
+// maps scene depth to depth buffer values, see setDepthRange
+Real g_depth_min = -128;
+Real g_depth_scale = (DEPTH_MAX - 1) / 256.0;
+
+#ifdef RENDER_STATS
+RenderStats g_render_stats;
+#endif
+
+
+// interpolates the quantised depth value for any x,y position on a face
+// defined by a vertex and the depth gradients of the face (see drawQuad)
+Real Object::interpolateDepth(int x, int y, Vector3 vert)
+{   
+#ifdef FIXED_POINT
+    // summed in 64 bits, the terms of a steep face are outside of the Q16.16
+    // range at pixels away from the vertex
+    return saturate(mulWide(vert.z - g_depth_min, g_depth_scale) + FIXED_ONE
+                    + mulWide(x - vert.x, _depth_dx) + mulWide(y - vert.y, _depth_dy));
+#else
+    return (vert.z - g_depth_min) * g_depth_scale + 1 + (x-vert.x) * _depth_dx + (y-vert.y) * _depth_dy;
+#endif
+}
 
 
-// interpolates the depth value for any x,y position on a face
-// defined by a vertex and the vector normal to the face
-float Object::interpolateDepth(int x, int y, Vector3 vert)
-{   
-    return vert.z - ((x-vert.x) * g_face_normal.x + (y-vert.y) * g_face_normal.y) / g_face_normal.z;
+// steps an interpolated depth by a number of pixels along a gradient
+inline Real stepDepth(Real depth, int steps, Real gradient)
+{
+#ifdef FIXED_POINT
+    return saturate((int64_t)depth.raw() + (int64_t)steps * gradient.raw());
+#else
+    return depth + steps * gradient;
+#endif
+}
+
+
+// limits a depth gradient to one depth range per pixel, a steeper face is edge
+// on and no more than one pixel of it along the gradient can be in range
+inline Real clampGradient(Real gradient)
+{
+    return max(min(gradient, Real(DEPTH_MAX)), Real(-DEPTH_MAX));
+}
+
+
+// converts an interpolated depth to a depth buffer value, clamping depths
+// outside of the scene's range (and NaN) to the range 1 to DEPTH_MAX
+inline DepthValue quantiseDepth(Real depth)
+{
+    if (!(depth >= 1)) {
+        return 1;
+    }
+    if (depth > DEPTH_MAX) {
+        return DEPTH_MAX;
+    }
+    return toInt(depth);
 }
 
 
@@ -68,30 +140,67 @@ void Object::fillByLine(int left_x, int right_x, int top_y, int bottom_y, Vector
         unsigned char first_bit = __clz(fill_test[0]) + ((__clz(fill_test[0])>>5) * __clz(fill_test[1]));
         unsigned char last_bit =  63 - (__clz(__rbit(fill_test[1])) + ((__clz(__rbit(fill_test[1]))>>5) * __clz(__rbit(fill_test[0]))));
         
-        for (int y = first_bit; y <= last_bit; y++){
+        // the depth is interpolated once per column and then stepped by
+        // the y gradient of the face for each pixel
+        Real interpolatedZ = interpolateDepth(x,first_bit,vert);
+        int y = first_bit;
+        while (y <= last_bit) {
             
-            float interpolatedZ = interpolateDepth(x,y,vert);
-            if (depth_buffer[x][y] < interpolatedZ)
-            {   
-                if(_fill == FILL_WHITE)
-                {
-                    depth_buffer[x][y] = interpolatedZ;
-                    lcd.setPixel(x, y, getFillBuffer(x, y));
-                }
-                else if(_fill == FILL_BLACK)
-                {
-                    depth_buffer[x][y] = interpolatedZ;
-                    lcd.setPixel(x, y, !getFillBuffer(x, y));
-                }
-                else
-                {
-                    if(getFillBuffer(x, y) == 1){
-                        lcd.setPixel(x, y, 1);
+            // the column is processed in 8 pixel bands, a band is skipped when the
+            // closest end of the span is behind every pixel already in the band
+            // (the test is strict to allow for the rounding of the stepped depth)
+            int const band = y / 8;
+            int const band_end = min((int)last_bit, band * 8 + 7);
+            Real const band_end_z = stepDepth(interpolatedZ, band_end - y, _depth_dy);
+            if (quantiseDepth(max(interpolatedZ, band_end_z)) < depth_band_min[x][band]) {
+                fill_buffer[x][band] = 0; // the face has no fill bits outside of the span
+                interpolatedZ = stepDepth(band_end_z, 1, _depth_dy);
+                y = band_end + 1;
+                RENDER_STAT(spans_rejected);
+                continue;
+            }
+            
+            bool depth_written = false;
+            for (; y <= band_end; y++, interpolatedZ = stepDepth(interpolatedZ, 1, _depth_dy)){
+                
+                DepthValue quantisedZ = quantiseDepth(interpolatedZ);
+                RENDER_STAT(pixels_tested);
+                if (depth_buffer[x][y] < quantisedZ)
+                {   
+                    if(_fill == FILL_WHITE)
+                    {
+                        depth_buffer[x][y] = quantisedZ;
+                        lcd.setPixel(x, y, getFillBuffer(x, y));
+                        depth_written = true;
+                        RENDER_STAT(pixels_written);
+                    }
+                    else if(_fill == FILL_BLACK)
+                    {
+                        depth_buffer[x][y] = quantisedZ;
+                        lcd.setPixel(x, y, !getFillBuffer(x, y));
+                        depth_written = true;
+                        RENDER_STAT(pixels_written);
+                    }
+                    else
+                    {
+                        if(getFillBuffer(x, y) == 1){
+                            lcd.setPixel(x, y, 1);
+                            RENDER_STAT(pixels_written);
+                        }
                     }
                 }
+                setFillBuffer(x, y, 0);
+                
             }
-            setFillBuffer(x, y, 0);
             
+            if (depth_written) {
+                // depths only ever get closer, so the band only needs updating here
+                DepthValue band_min = depth_buffer[x][band * 8];
+                for (int n = 1; n < 8; n++) {
+                    band_min = min(band_min, depth_buffer[x][band * 8 + n]);
+                }
+                depth_band_min[x][band] = band_min;
+            }
         }
         //printf("\n");
     }
@@ -168,10 +277,13 @@ void Object::drawLineArr(Vector3 start_point, Vector3 end_point)
 {
     // only draw lines starting with the top and left most vertex to avoid drawing
     // the same edges in both directions as this can cause unintended thicker line widths
-    int const x0 = max(start_point.x, end_point.x);
-    int const y0 = max(start_point.x, end_point.x) == start_point.x ? start_point.y:end_point.y;
-    int const x1 = min(start_point.x, end_point.x);
-    int const y1 = min(start_point.x, end_point.x) == start_point.x ? start_point.y:end_point.y;
+    // (the end points are swapped as a pair so that a vertical edge, where
+    // both x values are equal, keeps its y extent)
+    bool const start_is_right = start_point.x >= end_point.x;
+    int const x0 = toInt(start_is_right ? start_point.x:end_point.x);
+    int const y0 = toInt(start_is_right ? start_point.y:end_point.y);
+    int const x1 = toInt(start_is_right ? end_point.x:start_point.x);
+    int const y1 = toInt(start_is_right ? end_point.y:start_point.y);
     
     int const y_range = y1 - y0;
     int const x_range = x1 - x0;
@@ -196,13 +308,34 @@ void Object::drawLineArr(Vector3 start_point, Vector3 end_point)
 
         for (int y = start; y <= stop; y += step) {
             int const dy = y - y0;
-            int const x = x0 + x_range * dy / y_range;
+            // a zero length edge is a single point (the Cortex-M3 returns 0
+            // for a division by zero, but other targets trap)
+            int const x = y_range != 0 ? x0 + x_range * dy / y_range : x0;
             setFillBuffer(min(max(x,0),83), min(max(y,0),47), 1);
         }
     }
 }
 
 
+// returns a vertex of the object with the transformations applied,
+// transforming it only if no other face has used it during this draw
+Vector3 Object::transformedVertex(unsigned short index)
+{
+    if (index >= MAX_VERTS) {
+        // beyond the cache, a larger mesh is drawn but transformed per use
+        RENDER_STAT(vertex_transforms);
+        return transformPoint(_transform, toVector3(*(_verts_ptr + index))) + _instance_offset;
+    }
+    unsigned int const mask = 1u << (index % 32);
+    if (!(transformed_flags[index / 32] & mask)) {
+        transformed_flags[index / 32] |= mask;
+        transformed_verts[index] = transformPoint(_transform, toVector3(*(_verts_ptr + index)));
+        RENDER_STAT(vertex_transforms);
+    }
+    return transformed_verts[index] + _instance_offset;
+}
+
+
 // drawQuad will draw a quadralateral face in the lcd buffer and also update
 // the depth buffer
 void Object::drawQuad(int faceIndex)
@@ -211,26 +344,31 @@ void Object::drawQuad(int faceIndex)
     Vector3 quad_verts[4]; 
     
     for(int j = 0; j < 4; j++){
-         // apply the transformations to each vertex
-         
-         quad_verts[j] = rotateVector(*(_verts_ptr + *(_faces_ptr + faceIndex * 4 + j)) + _relative_location, _rotation) * _scale + _location;  //verts[faces[faceIndex][j]], rotation) * scale + offset;  faces[faceIndex][j]
+         // get the transformed position of each vertex
+         quad_verts[j] = transformedVertex(*(_faces_ptr + faceIndex * 4 + j));
     }
     
     // calculate the normal vector
     g_face_normal = calculateNormal(quad_verts[0], quad_verts[1], quad_verts[2]);
+    RENDER_STAT(faces);
     
     // backface culling, if the face is pointing towards the camera (pos z axis)
     if(g_face_normal.z < 0 || _fill == FILL_TRANSPARENT) 
     {
         // calculate the maximum and minimum X and Y vertex positions
-        int leftX   = (int)(min(min(quad_verts[0].x, quad_verts[1].x), min(quad_verts[2].x, quad_verts[3].x)));
-        int rightX  = (int)(max(max(quad_verts[0].x, quad_verts[1].x), max(quad_verts[2].x, quad_verts[3].x)));
-        int topY    = (int)(min(min(quad_verts[0].y, quad_verts[1].y), min(quad_verts[2].y, quad_verts[3].y)));
-        int bottomY = (int)(max(max(quad_verts[0].y, quad_verts[1].y), max(quad_verts[2].y, quad_verts[3].y)));
+        int leftX   = toInt(min(min(quad_verts[0].x, quad_verts[1].x), min(quad_verts[2].x, quad_verts[3].x)));
+        int rightX  = toInt(max(max(quad_verts[0].x, quad_verts[1].x), max(quad_verts[2].x, quad_verts[3].x)));
+        int topY    = toInt(min(min(quad_verts[0].y, quad_verts[1].y), min(quad_verts[2].y, quad_verts[3].y)));
+        int bottomY = toInt(max(max(quad_verts[0].y, quad_verts[1].y), max(quad_verts[2].y, quad_verts[3].y)));
         
         if (not(rightX < 0 || leftX > 83 || topY > 47 || bottomY < 0))
         {   // if the face is not completely outside of the frame
             
+            // depth gradients of the face plane in depth buffer units, calculated
+            // once per face so that no division is needed per pixel
+            _depth_dx = clampGradient(-g_face_normal.x * g_depth_scale / g_face_normal.z);
+            _depth_dy = clampGradient(-g_face_normal.y * g_depth_scale / g_face_normal.z);
+            
             // constrain the maxima and minima to the screen space
             leftX = max(leftX,0);
             rightX = min(rightX,83);
@@ -247,40 +385,110 @@ void Object::drawQuad(int faceIndex)
             // clear fill_buffer, update depth_buffer & set lcd pixel values
             fillByLine(leftX, rightX, topY, bottomY, quad_verts[0]);
         }
+        else
+        {
+            RENDER_STAT(faces_clipped);
+        }
+    }
+    else
+    {
+        RENDER_STAT(faces_culled);
     }
 }
 
 
+// clears the depth buffer, 0 is further away than any face can be drawn
 void clearDepth()
 {
-    for(int y = 0; y < 48; y++ ){
-        for(int x = 0; x < 84; x++){
-            depth_buffer[x][y] = -INFINITY; // clear the depth buffer
-        }
-    }
+    memset(depth_buffer, 0, sizeof(depth_buffer));
+    memset(depth_band_min, 0, sizeof(depth_band_min));
+}
+
+
+// sets the range of z values in the scene that is spread over the depth
+// buffer's resolution. Faces outside of the range are clamped to its limits
+// and lose their order, so it should cover the radius (Object::getRadius)
+// times the scale of everything drawn
+void setDepthRange(Real z_min, Real z_max)
+{
+    g_depth_min = z_min;
+    g_depth_scale = Real(DEPTH_MAX - 1) / (z_max - z_min);
 }
 
 
 void Object::setObjData(ObjData& obj)
 {
     _verts_ptr = obj.verts_ptr;
+    _verts_len = obj.verts_len;
     _faces_ptr = obj.faces_ptr;
     _faces_len = obj.faces_len;
+    _radius = obj.radius;
+}
+
+
+// the distance of the furthest vertex of the mesh from its origin, before scaling
+Real Object::getRadius()
+{
+    return _radius;
 }
 
 
 void Object::setLocRotScale(Vector3 location, Vector3 relative_location, Quaternion rotation, Vector3 scale)
 {
-    _location = location;
-    _relative_location = relative_location;
-    _rotation = rotation;
-    _scale = scale;
+    // the transformations are combined into one matrix, so that each vertex
+    // only needs 9 multiply-adds instead of a full quaternion rotation
+    _transform = toAffineMatrix(rotation, relative_location, scale, location);
+}
+
+
+// sorts the faces of the object into face_order from the closest to the
+// furthest, using a counting sort on the depth of the centre of each face.
+// Drawing the closest faces first means that the faces behind them fail the
+// depth test (or the band test in fillByLine) instead of being overwritten
+void Object::sortFaces()
+{
+    unsigned short bucket_count[256] = {0};
+    for (int i = 0; i < _faces_len; i++)
+    {
+        Real z_sum = 0;
+        for (int j = 0; j < 4; j++) {
+            z_sum += transformedVertex(*(_faces_ptr + i * 4 + j)).z;
+        }
+        int const code = toInt((z_sum / 4 - g_depth_min) * g_depth_scale) >> DEPTH_BUCKET_SHIFT;
+        face_keys[i] = min(max(code, 0), 255);
+        bucket_count[face_keys[i]]++;
+    }
+    
+    // the largest (closest) keys are placed first
+    unsigned short start = 0;
+    for (int key = 255; key >= 0; key--) {
+        face_bucket_start[key] = start;
+        start += bucket_count[key];
+    }
+    for (int i = 0; i < _faces_len; i++) {
+        face_order[face_bucket_start[face_keys[i]]++] = i;
+    }
 }
 
 
-void Object::draw(FillType fill)
+// draws the object, optionally sorting the faces front to back first, which
+// is worth it for meshes where many faces overlap
+void Object::draw(FillType fill, bool sort_faces)
 {
     _fill = fill;
+    // invalidate the transformed vertices of the previous draw
+    memset(transformed_flags, 0, ((min((int)_verts_len, MAX_VERTS) + 31) / 32) * sizeof(transformed_flags[0]));
+    
+    if (sort_faces && _faces_len <= MAX_FACES)
+    {
+        sortFaces();
+        for (int i = 0; i < _faces_len; i++)
+        {
+            drawQuad(face_order[i]);
+        }
+        return;
+    }
+    
     // for all faces
     for (int i = 0; i < _faces_len; i++) //sizeof(faces)/sizeof(faces[0]); i++)
     {
@@ -290,16 +498,29 @@ void Object::draw(FillType fill)
 }
 
 
-
-
-
-
-
-
-
-
-
-
-
-
-
+// draws the object once for each instance. The vertices are transformed once
+// for all of the instances and each instance then only adds its offset, as the
+// rotation and scale are shared. The relative location passed to
+// setLocRotScale should be zero
+void Object::drawInstances(const Instance *instances, int count)
+{
+    memset(transformed_flags, 0, ((min((int)_verts_len, MAX_VERTS) + 31) / 32) * sizeof(transformed_flags[0]));
+    for (int n = 0; n < count; n++)
+    {
+        // only the rotation and scale apply to the offset, the location
+        // is already part of the transformed vertices
+        Vector3 const r = instances[n].relative_location;
+        _instance_offset.x = _transform.m[0][0] * r.x + _transform.m[0][1] * r.y + _transform.m[0][2] * r.z;
+        _instance_offset.y = _transform.m[1][0] * r.x + _transform.m[1][1] * r.y + _transform.m[1][2] * r.z;
+        _instance_offset.z = _transform.m[2][0] * r.x + _transform.m[2][1] * r.y + _transform.m[2][2] * r.z;
+        _fill = instances[n].fill;
+        for (int i = 0; i < _faces_len; i++)
+        {
+            // faces past the mask's 32 bits are always drawn
+            if (i >= 32 || (instances[n].face_mask & (1u << i))) {
+                drawQuad(i);
+            }
+        }
+    }
+    _instance_offset = Vector3();
+}
@@ -5,35 +5,89 @@
 #include "N5110.h"
 #include "Utils.h"
 
+// uncomment to store depth in 8 bits (4 KB buffer) instead of 16 bits (8 KB)
+//#define DEPTH_BUFFER_8BIT
+
+// depth buffer element type, 0 is the cleared (furthest) value
+#ifdef DEPTH_BUFFER_8BIT
+typedef unsigned char DepthValue;
+#define DEPTH_MAX 255
+#else
+typedef unsigned short DepthValue;
+#define DEPTH_MAX 32767 // 15 bits so that quantised depths stay within Q16.16
+#endif
+
+
+// vertex count of the largest mesh (trophy_object), sizes the transformed vertex cache.
+// The vertices of a larger mesh past this are transformed each time a face uses them
+#define MAX_VERTS 570
+// face count of the largest mesh (trophy_object), sizes the face sorting arrays
+#define MAX_FACES 556
+
 
 void clearDepth();
+void setDepthRange(Real z_min, Real z_max);
+
+
+#ifdef RENDER_STATS
+// counters accumulated by Object::draw, used by the host benchmarks
+struct RenderStats{
+    unsigned int faces;          // faces submitted to drawQuad
+    unsigned int faces_culled;   // faces rejected by backface culling
+    unsigned int faces_clipped;  // faces completely outside of the frame
+    unsigned int pixels_tested;  // depth tests performed in fillByLine
+    unsigned int pixels_written; // pixels plotted to the lcd buffer
+    unsigned int vertex_transforms; // vertices transformed into screen space
+    unsigned int spans_rejected; // column spans skipped by the coarse depth test
+};
+
+extern RenderStats g_render_stats;
+#define RENDER_STAT(counter) (g_render_stats.counter++)
+#else
+#define RENDER_STAT(counter)
+#endif
+
+
+// a copy of an object drawn by Object::drawInstances
+struct Instance{
+    Vector3 relative_location; // offset from the object's origin before rotation and scaling
+    FillType fill;
+    unsigned int face_mask;    // bit n is set to draw face n, faces from 32 on are always drawn
+};
 
 
 class Object
 {
 public:
     Object();
-    void draw(FillType fill);
+    void draw(FillType fill, bool sort_faces = false);
+    void drawInstances(const Instance *instances, int count);
     void setObjData(ObjData& obj);
+    Real getRadius();
     void setLocRotScale(Vector3 location, Vector3 relative_location, Quaternion rotation, Vector3 scale);
 
 private:
-    float interpolateDepth(int x, int y, Vector3 vert);
+    Real interpolateDepth(int x, int y, Vector3 vert);
     void setFillBuffer(int x, int y, bool val);
     bool getFillBuffer(int x, int y);
     void fillByLine(int left_x, int right_x, int top_y, int bottom_y, Vector3 vert);
     void drawLineArr(Vector3 start_point, Vector3 end_point);
     void drawQuad(int faceIndex);
+    void sortFaces();
+    Vector3 transformedVertex(unsigned short index);
     
-    const Vector3 *_verts_ptr;
+    const Vertex *_verts_ptr;
+    unsigned short _verts_len;
     const unsigned short *_faces_ptr;
     unsigned short _faces_len;
+    Real _radius;
     
-    Vector3 _location;
-    Vector3 _relative_location;
-    Quaternion _rotation;
-    Vector3 _scale;
+    Matrix3x4 _transform; // location, relative location, rotation and scale (see setLocRotScale)
+    Vector3 _instance_offset; // screen space offset of the instance being drawn
     FillType _fill;
+    
+    Real _depth_dx; // change in depth per pixel along x of the current face
+    Real _depth_dy; // change in depth per pixel along y of the current face
 };
 
 #endif
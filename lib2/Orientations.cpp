@@ -0,0 +1,242 @@
+/*
+    Tile orientation tables
+    Generated by host/OrientationGen.cpp (orientgen), do not edit
+*/
+
+#include "Utils.h"
+
+// the game space masks of every translation of each orientation
+const int tile_placement_list[676] = {
+    0x1000000, 0x2000000, 0x4000000, 0x0200000, 0x0400000, 0x0800000,
+    0x0040000, 0x0080000, 0x0100000, 0x0008000, 0x0010000, 0x0020000,
+    0x0001000, 0x0002000, 0x0004000, 0x0000200, 0x0000400, 0x0000800,
+    0x0000040, 0x0000080, 0x0000100, 0x0000008, 0x0000010, 0x0000020,
+    0x0000001, 0x0000002, 0x0000004,
+    0x3000000, 0x6000000, 0x0600000, 0x0C00000, 0x00C0000, 0x0180000,
+    0x0018000, 0x0030000, 0x0003000, 0x0006000, 0x0000600, 0x0000C00,
+    0x00000C0, 0x0000180, 0x0000018, 0x0000030, 0x0000003, 0x0000006,
+    0x1008000, 0x2010000, 0x4020000, 0x0201000, 0x0402000, 0x0804000,
+    0x0040200, 0x0080400, 0x0100800, 0x0008040, 0x0010080, 0x0020100,
+    0x0001008, 0x0002010, 0x0004020, 0x0000201, 0x0000402, 0x0000804,
+    0x1200000, 0x2400000, 0x4800000, 0x0240000, 0x0480000, 0x0900000,
+    0x0009000, 0x0012000, 0x0024000, 0x0001200, 0x0002400, 0x0004800,
+    0x0000048, 0x0000090, 0x0000120, 0x0000009, 0x0000012, 0x0000024,
+    0x3400000, 0x6800000, 0x0680000, 0x0D00000, 0x001A000, 0x0034000,
+    0x0003400, 0x0006800, 0x00000D0, 0x00001A0, 0x000001A, 0x0000034,
+    0x1009000, 0x2012000, 0x4024000, 0x0201200, 0x0402400, 0x0804800,
+    0x0008048, 0x0010090, 0x0020120, 0x0001009, 0x0002012, 0x0004024,
+    0x3200000, 0x6400000, 0x0640000, 0x0C80000, 0x0019000, 0x0032000,
+    0x0003200, 0x0006400, 0x00000C8, 0x0000190, 0x0000019, 0x0000032,
+    0x1208000, 0x2410000, 0x4820000, 0x0241000, 0x0482000, 0x0904000,
+    0x0009040, 0x0012080, 0x0024100, 0x0001208, 0x0002410, 0x0004820,
+    0x1600000, 0x2C00000, 0x02C0000, 0x0580000, 0x000B000, 0x0016000,
+    0x0001600, 0x0002C00, 0x0000058, 0x00000B0, 0x000000B, 0x0000016,
+    0x1201000, 0x2402000, 0x4804000, 0x0240200, 0x0480400, 0x0900800,
+    0x0009008, 0x0012010, 0x0024020, 0x0001201, 0x0002402, 0x0004804,
+    0x2600000, 0x4C00000, 0x04C0000, 0x0980000, 0x0013000, 0x0026000,
+    0x0002600, 0x0004C00, 0x0000098, 0x0000130, 0x0000013, 0x0000026,
+    0x0209000, 0x0412000, 0x0824000, 0x0041200, 0x0082400, 0x0104800,
+    0x0001048, 0x0002090, 0x0004120, 0x0000209, 0x0000412, 0x0000824,
+    0x3010000, 0x6020000, 0x0602000, 0x0C04000, 0x00C0400, 0x0180800,
+    0x0018080, 0x0030100, 0x0003010, 0x0006020, 0x0000602, 0x0000C04,
+    0x2018000, 0x4030000, 0x0403000, 0x0806000, 0x0080600, 0x0100C00,
+    0x00100C0, 0x0020180, 0x0002018, 0x0004030, 0x0000403, 0x0000806,
+    0x1018000, 0x2030000, 0x0203000, 0x0406000, 0x0040600, 0x0080C00,
+    0x00080C0, 0x0010180, 0x0001018, 0x0002030, 0x0000203, 0x0000406,
+    0x3008000, 0x6010000, 0x0601000, 0x0C02000, 0x00C0200, 0x0180400,
+    0x0018040, 0x0030080, 0x0003008, 0x0006010, 0x0000601, 0x0000C02,
+    0x7000000, 0x0E00000, 0x01C0000, 0x0038000, 0x0007000, 0x0000E00,
+    0x00001C0, 0x0000038, 0x0000007,
+    0x1008040, 0x2010080, 0x4020100, 0x0201008, 0x0402010, 0x0804020,
+    0x0040201, 0x0080402, 0x0100804,
+    0x1240000, 0x2480000, 0x4900000, 0x0009200, 0x0012400, 0x0024800,
+    0x0000049, 0x0000092, 0x0000124,
+    0x7200000, 0x0E40000, 0x0039000, 0x0007200, 0x00001C8, 0x0000039,
+    0x1208040, 0x2410080, 0x4820100, 0x0241008, 0x0482010, 0x0904020,
+    0x7800000, 0x0F00000, 0x003C000, 0x0007800, 0x00001E0, 0x000003C,
+    0x1008048, 0x2010090, 0x4020120, 0x0201009, 0x0402012, 0x0804024,
+    0x12C0000, 0x2580000, 0x0009600, 0x0012C00, 0x000004B, 0x0000096,
+    0x1240200, 0x2480400, 0x4900800, 0x0009201, 0x0012402, 0x0024804,
+    0x24C0000, 0x4980000, 0x0012600, 0x0024C00, 0x0000093, 0x0000126,
+    0x0049200, 0x0092400, 0x0124800, 0x0000249, 0x0000492, 0x0000924,
+    0x4E00000, 0x09C0000, 0x0027000, 0x0004E00, 0x0000138, 0x0000027,
+    0x0201048, 0x0402090, 0x0804120, 0x0040209, 0x0080412, 0x0100824,
+    0x1E00000, 0x03C0000, 0x000F000, 0x0001E00, 0x0000078, 0x000000F,
+    0x1201008, 0x2402010, 0x4804020, 0x0240201, 0x0480402, 0x0900804,
+    0x3480000, 0x6900000, 0x001A400, 0x0034800, 0x00000D2, 0x00001A4,
+    0x1009200, 0x2012400, 0x4024800, 0x0008049, 0x0010092, 0x0020124,
+    0x3240000, 0x6480000, 0x0019200, 0x0032400, 0x00000C9, 0x0000192,
+    0x1248000, 0x2490000, 0x4920000, 0x0009240, 0x0012480, 0x0024900,
+    0x7008000, 0x0E01000, 0x01C0200, 0x0038040, 0x0007008, 0x0000E01,
+    0x3010080, 0x6020100, 0x0602010, 0x0C04020, 0x00C0402, 0x0180804,
+    0x4038000, 0x0807000, 0x0100E00, 0x00201C0, 0x0004038, 0x0000807,
+    0x10080C0, 0x2010180, 0x0201018, 0x0402030, 0x0040203, 0x0080406,
+    0x1038000, 0x0207000, 0x0040E00, 0x00081C0, 0x0001038, 0x0000207,
+    0x3008040, 0x6010080, 0x0601008, 0x0C02010, 0x00C0201, 0x0180402,
+    0x7020000, 0x0E04000, 0x01C0800, 0x0038100, 0x0007020, 0x0000E04,
+    0x20100C0, 0x4020180, 0x0402018, 0x0804030, 0x0080403, 0x0100806,
+    0x7400000, 0x0E80000, 0x003A000, 0x0007400, 0x00001D0, 0x000003A,
+    0x1009040, 0x2012080, 0x4024100, 0x0201208, 0x0402410, 0x0804820,
+    0x1640000, 0x2C80000, 0x000B200, 0x0016400, 0x0000059, 0x00000B2,
+    0x1241000, 0x2482000, 0x4904000, 0x0009208, 0x0012410, 0x0024820,
+    0x2680000, 0x4D00000, 0x0013400, 0x0026800, 0x000009A, 0x0000134,
+    0x0209200, 0x0412400, 0x0824800, 0x0001049, 0x0002092, 0x0004124,
+    0x2E00000, 0x05C0000, 0x0017000, 0x0002E00, 0x00000B8, 0x0000017,
+    0x0209008, 0x0412010, 0x0824020, 0x0041201, 0x0082402, 0x0104804,
+    0x7010000, 0x0E02000, 0x01C0400, 0x0038080, 0x0007010, 0x0000E02,
+    0x2018080, 0x4030100, 0x0403010, 0x0806020, 0x0080602, 0x0100C04,
+    0x2038000, 0x0407000, 0x0080E00, 0x00101C0, 0x0002038, 0x0000407,
+    0x1018040, 0x2030080, 0x0203008, 0x0406010, 0x0040601, 0x0080C02,
+    0x7A00000, 0x0F40000, 0x003D000, 0x0007A00, 0x00001E8, 0x000003D,
+    0x1208048, 0x2410090, 0x4820120, 0x0241009, 0x0482012, 0x0904024,
+    0x32C0000, 0x6580000, 0x0019600, 0x0032C00, 0x00000CB, 0x0000196,
+    0x1248200, 0x2490400, 0x4920800, 0x0009241, 0x0012482, 0x0024904,
+    0x34C0000, 0x6980000, 0x001A600, 0x0034C00, 0x00000D3, 0x00001A6,
+    0x1049200, 0x2092400, 0x4124800, 0x0008249, 0x0010492, 0x0020924,
+    0x5E00000, 0x0BC0000, 0x002F000, 0x0005E00, 0x0000178, 0x000002F,
+    0x1201048, 0x2402090, 0x4804120, 0x0240209, 0x0480412, 0x0900824,
+    0x7028000, 0x0E05000, 0x01C0A00, 0x0038140, 0x0007028, 0x0000E05,
+    0x30100C0, 0x6020180, 0x0602018, 0x0C04030, 0x00C0403, 0x0180806,
+    0x5038000, 0x0A07000, 0x0140E00, 0x00281C0, 0x0005038, 0x0000A07,
+    0x30080C0, 0x6010180, 0x0601018, 0x0C02030, 0x00C0203, 0x0180406,
+    0x6600000, 0x0CC0000, 0x0033000, 0x0006600, 0x0000198, 0x0000033,
+    0x0209040, 0x0412080, 0x0824100, 0x0041208, 0x0082410, 0x0104820,
+    0x3C00000, 0x0780000, 0x001E000, 0x0003C00, 0x00000F0, 0x000001E,
+    0x1009008, 0x2012010, 0x4024020, 0x0201201, 0x0402402, 0x0804804,
+    0x1680000, 0x2D00000, 0x000B400, 0x0016800, 0x000005A, 0x00000B4,
+    0x1201200, 0x2402400, 0x4804800, 0x0009009, 0x0012012, 0x0024024,
+    0x2640000, 0x4C80000, 0x0013200, 0x0026400, 0x0000099, 0x0000132,
+    0x0249000, 0x0492000, 0x0924000, 0x0001248, 0x0002490, 0x0004920,
+    0x6018000, 0x0C03000, 0x0180600, 0x00300C0, 0x0006018, 0x0000C03,
+    0x1018080, 0x2030100, 0x0203010, 0x0406020, 0x0040602, 0x0080C04,
+    0x3030000, 0x0606000, 0x00C0C00, 0x0018180, 0x0003030, 0x0000606,
+    0x2018040, 0x4030080, 0x0403008, 0x0806010, 0x0080601, 0x0100C02,
+    0x3410000, 0x6820000, 0x0682000, 0x0D04000, 0x001A080, 0x0034100,
+    0x0003410, 0x0006820,
+    0x201A000, 0x4034000, 0x0403400, 0x0806800, 0x00100D0, 0x00201A0,
+    0x000201A, 0x0004034,
+    0x1019000, 0x2032000, 0x0203200, 0x0406400, 0x00080C8, 0x0010190,
+    0x0001019, 0x0002032,
+    0x3208000, 0x6410000, 0x0641000, 0x0C82000, 0x0019040, 0x0032080,
+    0x0003208, 0x0006410,
+    0x1601000, 0x2C02000, 0x02C0200, 0x0580400, 0x000B008, 0x0016010,
+    0x0001601, 0x0002C02,
+    0x2602000, 0x4C04000, 0x04C0400, 0x0980800, 0x0013010, 0x0026020,
+    0x0002602, 0x0004C04,
+    0x0413000, 0x0826000, 0x0082600, 0x0104C00, 0x0002098, 0x0004130,
+    0x0000413, 0x0000826,
+    0x020B000, 0x0416000, 0x0041600, 0x0082C00, 0x0001058, 0x00020B0,
+    0x000020B, 0x0000416,
+};
+
+// the distinct orientations of every tile kind, moved to the 0,0,0 corner
+const Orientation tile_orientation_list[87] = {
+    // TILE_O
+    {{0x4000000, {1,1,1}}, tile_placement_list +   0},
+    // TILE_i
+    {{0x6000000, {2,1,1}}, tile_placement_list +  27},
+    {{0x4020000, {1,1,2}}, tile_placement_list +  45},
+    {{0x4800000, {1,2,1}}, tile_placement_list +  63},
+    // TILE_l
+    {{0x6800000, {2,2,1}}, tile_placement_list +  81},
+    {{0x4024000, {1,2,2}}, tile_placement_list +  93},
+    {{0x6400000, {2,2,1}}, tile_placement_list + 105},
+    {{0x4820000, {1,2,2}}, tile_placement_list + 117},
+    {{0x2C00000, {2,2,1}}, tile_placement_list + 129},
+    {{0x4804000, {1,2,2}}, tile_placement_list + 141},
+    {{0x4C00000, {2,2,1}}, tile_placement_list + 153},
+    {{0x0824000, {1,2,2}}, tile_placement_list + 165},
+    {{0x6020000, {2,1,2}}, tile_placement_list + 177},
+    {{0x4030000, {2,1,2}}, tile_placement_list + 189},
+    {{0x2030000, {2,1,2}}, tile_placement_list + 201},
+    {{0x6010000, {2,1,2}}, tile_placement_list + 213},
+    // TILE_I
+    {{0x7000000, {3,1,1}}, tile_placement_list + 225},
+    {{0x4020100, {1,1,3}}, tile_placement_list + 234},
+    {{0x4900000, {1,3,1}}, tile_placement_list + 243},
+    // TILE_L
+    {{0x7200000, {3,2,1}}, tile_placement_list + 252},
+    {{0x4820100, {1,2,3}}, tile_placement_list + 258},
+    {{0x7800000, {3,2,1}}, tile_placement_list + 264},
+    {{0x4020120, {1,2,3}}, tile_placement_list + 270},
+    {{0x2580000, {2,3,1}}, tile_placement_list + 276},
+    {{0x4900800, {1,3,2}}, tile_placement_list + 282},
+    {{0x4980000, {2,3,1}}, tile_placement_list + 288},
+    {{0x0124800, {1,3,2}}, tile_placement_list + 294},
+    {{0x4E00000, {3,2,1}}, tile_placement_list + 300},
+    {{0x0804120, {1,2,3}}, tile_placement_list + 306},
+    {{0x1E00000, {3,2,1}}, tile_placement_list + 312},
+    {{0x4804020, {1,2,3}}, tile_placement_list + 318},
+    {{0x6900000, {2,3,1}}, tile_placement_list + 324},
+    {{0x4024800, {1,3,2}}, tile_placement_list + 330},
+    {{0x6480000, {2,3,1}}, tile_placement_list + 336},
+    {{0x4920000, {1,3,2}}, tile_placement_list + 342},
+    {{0x7008000, {3,1,2}}, tile_placement_list + 348},
+    {{0x6020100, {2,1,3}}, tile_placement_list + 354},
+    {{0x4038000, {3,1,2}}, tile_placement_list + 360},
+    {{0x2010180, {2,1,3}}, tile_placement_list + 366},
+    {{0x1038000, {3,1,2}}, tile_placement_list + 372},
+    {{0x6010080, {2,1,3}}, tile_placement_list + 378},
+    {{0x7020000, {3,1,2}}, tile_placement_list + 384},
+    {{0x4020180, {2,1,3}}, tile_placement_list + 390},
+    // TILE_T
+    {{0x7400000, {3,2,1}}, tile_placement_list + 396},
+    {{0x4024100, {1,2,3}}, tile_placement_list + 402},
+    {{0x2C80000, {2,3,1}}, tile_placement_list + 408},
+    {{0x4904000, {1,3,2}}, tile_placement_list + 414},
+    {{0x4D00000, {2,3,1}}, tile_placement_list + 420},
+    {{0x0824800, {1,3,2}}, tile_placement_list + 426},
+    {{0x2E00000, {3,2,1}}, tile_placement_list + 432},
+    {{0x0824020, {1,2,3}}, tile_placement_list + 438},
+    {{0x7010000, {3,1,2}}, tile_placement_list + 444},
+    {{0x4030100, {2,1,3}}, tile_placement_list + 450},
+    {{0x2038000, {3,1,2}}, tile_placement_list + 456},
+    {{0x2030080, {2,1,3}}, tile_placement_list + 462},
+    // TILE_C
+    {{0x7A00000, {3,2,1}}, tile_placement_list + 468},
+    {{0x4820120, {1,2,3}}, tile_placement_list + 474},
+    {{0x6580000, {2,3,1}}, tile_placement_list + 480},
+    {{0x4920800, {1,3,2}}, tile_placement_list + 486},
+    {{0x6980000, {2,3,1}}, tile_placement_list + 492},
+    {{0x4124800, {1,3,2}}, tile_placement_list + 498},
+    {{0x5E00000, {3,2,1}}, tile_placement_list + 504},
+    {{0x4804120, {1,2,3}}, tile_placement_list + 510},
+    {{0x7028000, {3,1,2}}, tile_placement_list + 516},
+    {{0x6020180, {2,1,3}}, tile_placement_list + 522},
+    {{0x5038000, {3,1,2}}, tile_placement_list + 528},
+    {{0x6010180, {2,1,3}}, tile_placement_list + 534},
+    // TILE_Z
+    {{0x6600000, {3,2,1}}, tile_placement_list + 540},
+    {{0x0824100, {1,2,3}}, tile_placement_list + 546},
+    {{0x3C00000, {3,2,1}}, tile_placement_list + 552},
+    {{0x4024020, {1,2,3}}, tile_placement_list + 558},
+    {{0x2D00000, {2,3,1}}, tile_placement_list + 564},
+    {{0x4804800, {1,3,2}}, tile_placement_list + 570},
+    {{0x4C80000, {2,3,1}}, tile_placement_list + 576},
+    {{0x0924000, {1,3,2}}, tile_placement_list + 582},
+    {{0x6018000, {3,1,2}}, tile_placement_list + 588},
+    {{0x2030100, {2,1,3}}, tile_placement_list + 594},
+    {{0x3030000, {3,1,2}}, tile_placement_list + 600},
+    {{0x4030080, {2,1,3}}, tile_placement_list + 606},
+    // TILE_X
+    {{0x6820000, {2,2,2}}, tile_placement_list + 612},
+    {{0x4034000, {2,2,2}}, tile_placement_list + 620},
+    {{0x2032000, {2,2,2}}, tile_placement_list + 628},
+    {{0x6410000, {2,2,2}}, tile_placement_list + 636},
+    {{0x2C02000, {2,2,2}}, tile_placement_list + 644},
+    {{0x4C04000, {2,2,2}}, tile_placement_list + 652},
+    {{0x0826000, {2,2,2}}, tile_placement_list + 660},
+    {{0x0416000, {2,2,2}}, tile_placement_list + 668},
+};
+
+const TileOrientations tile_orientations[TILE_KINDS] = {
+    {{0x4000000, {1,1,1}},  1, tile_orientation_list +  0},  // TILE_O
+    {{0x6000000, {2,1,1}},  3, tile_orientation_list +  1},  // TILE_i
+    {{0x6800000, {2,2,1}}, 12, tile_orientation_list +  4},  // TILE_l
+    {{0x7000000, {3,1,1}},  3, tile_orientation_list + 16},  // TILE_I
+    {{0x7200000, {3,2,1}}, 24, tile_orientation_list + 19},  // TILE_L
+    {{0x7400000, {3,2,1}}, 12, tile_orientation_list + 43},  // TILE_T
+    {{0x7A00000, {3,2,1}}, 12, tile_orientation_list + 55},  // TILE_C
+    {{0x6600000, {3,2,1}}, 12, tile_orientation_list + 67},  // TILE_Z
+    {{0x6820000, {2,2,2}},  8, tile_orientation_list + 79},  // TILE_X
+};
@@ -0,0 +1,209 @@
+/*
+    Solvability oracle
+    Searches the placements left in a level to find whether the game space can
+    still be filled, and a move that keeps it fillable
+*/
+
+#include "mbed.h"
+#include "Utils.h"
+#include "Solver.h"
+
+#define FULL_SPACE 0x7FFFFFF
+#define EMPTY_ENTRY 0xFFFFFFFF // a full space is never dead, so this key is never stored
+
+
+Solver::Solver()
+        :
+        _tile_count(0),
+        _budget(0),
+        _nodes(0),
+        _hint(0),
+        _result(SOLVE_UNKNOWN),
+        _depth(0)
+{
+    reset();
+}
+
+
+// forgets the dead positions, must be called when the tile list changes
+void Solver::reset()
+{
+    for(int n = 0; n < (1 << SOLVER_TABLE_BITS); n++){
+        _dead[n] = EMPTY_ENTRY;
+    }
+}
+
+
+// begins a search for whether the tiles of a level from index onwards can
+// fill the space, searching at most budget positions. The last tile of the
+// list repeats once it is reached, as in Game::getFrame. The search is made
+// by run, a search that hasn't finished is dropped
+void Solver::start(unsigned int space, const Level &level, int index, int budget)
+{
+    _budget = budget;
+    _nodes = 0;
+    _hint = 0;
+    _depth = 0;
+    _result = SOLVE_SEARCHING;
+    
+    _tile_count = (int)level.size();
+    if(_tile_count == 0 || _tile_count > SOLVER_MAX_TILES){
+        _result = SOLVE_UNKNOWN;
+        return;
+    }
+    unsigned short kinds = 0;
+    for(int n = _tile_count-1; n >= 0; n--){
+        _orientations[n] = &tile_orientations[level[n]];
+        kinds |= 1 << level[n];
+        _kinds_left[n] = kinds;
+    }
+    
+    enter(space, index);
+}
+
+
+// carries on the search for about slice_us microseconds (with no limit if it
+// is 0). The time is only read every few steps, so a slice can run over by
+// up to 2^SOLVER_CHECK_BITS steps. Returns SOLVE_SEARCHING if the search
+// hasn't finished, otherwise the result, which is SOLVE_UNKNOWN if the budget
+// ran out first
+SolveResult Solver::run(int slice_us)
+{
+    uint32_t const begin = us_ticker_read();
+    int steps = 0;
+    while(_result == SOLVE_SEARCHING){
+        if(slice_us > 0 && (++steps & ((1 << SOLVER_CHECK_BITS)-1)) == 0
+                && us_ticker_read() - begin >= (uint32_t)slice_us){
+            break;
+        }
+        step();
+    }
+    return _result;
+}
+
+
+// searches the whole of a level at once, see start
+SolveResult Solver::solve(unsigned int space, const Level &level, int index, int budget)
+{
+    start(space, level, index, budget);
+    return run(0);
+}
+
+
+// returns the game space mask of the first move of the solution found by the
+// last search, or 0 if there wasn't one
+int Solver::getHint()
+{
+    return _hint;
+}
+
+
+// returns the number of positions searched by the last search
+int Solver::getNodes()
+{
+    return _nodes;
+}
+
+
+// tries the next move from the top of the search path, the position is dead
+// once every move from it has been tried
+void Solver::step()
+{
+    SolverFrame &frame = _stack[_depth-1];
+    const TileOrientations *orientations = _orientations[frame.index];
+    while(frame.placement >= frame.list.count){
+        if(++frame.orientation >= orientations->count){
+            setDead(frame.space | (frame.index << 27));
+            if(--_depth == 0){
+                _result = SOLVE_DEAD;
+            }
+            return;
+        }
+        frame.list = findPlacements(orientations->orientations[frame.orientation], frame.space);
+        frame.placement = 0;
+    }
+    int const next = frame.index+1 < _tile_count ? frame.index+1:frame.index;
+    enter(frame.space | frame.list.masks[frame.placement++], next);
+}
+
+
+// moves the search to a position, pushing it onto the search path unless it
+// is already known whether the space can be filled from it
+void Solver::enter(unsigned int space, int index)
+{
+    if(space == FULL_SPACE){
+        if(_depth > 0){
+            _hint = _stack[0].list.masks[_stack[0].placement-1]; // the move from the first position
+        }
+        _result = SOLVE_SOLVABLE;
+        return;
+    }
+    unsigned int const key = space | (index << 27);
+    bool dead = isDead(key);
+    if(!dead){
+        if(++_nodes > _budget){
+            _result = SOLVE_UNKNOWN; // not every move was tried, so it isn't known to be dead
+            return;
+        }
+        if(!coverable(space, index)){
+            setDead(key);
+            dead = true;
+        }
+    }
+    if(dead){
+        if(_depth == 0){
+            _result = SOLVE_DEAD;
+        }
+        return;
+    }
+    
+    SolverFrame &frame = _stack[_depth++];
+    frame.space = space;
+    frame.index = index;
+    frame.orientation = -1;
+    frame.placement = 0;
+    frame.list.count = 0;
+}
+
+
+// returns false if an empty cell can't be covered by any placement of the
+// tiles that are left. Filling the space only takes positions away from a
+// piece, so a cell that none of them covers now can never be filled
+bool Solver::coverable(unsigned int space, int index)
+{
+    unsigned int covered = space;
+    for(int kind = 0; kind < TILE_KINDS; kind++){
+        if(!(_kinds_left[index] & (1 << kind))){
+            continue;
+        }
+        const TileOrientations &orientations = tile_orientations[kind];
+        for(int i = 0; i < orientations.count; i++){
+            const Orientation &orientation = orientations.orientations[i];
+            int const count = (4-orientation.tile.size[0])*(4-orientation.tile.size[1])*(4-orientation.tile.size[2]);
+            for(int n = 0; n < count; n++){
+                if((orientation.placements[n] & space) == 0){
+                    covered |= orientation.placements[n];
+                }
+            }
+        }
+    }
+    return covered == FULL_SPACE;
+}
+
+
+// the table slot of a key (Fibonacci hashing)
+static unsigned int slot(unsigned int key)
+{
+    return (key * 2654435761u) >> (32 - SOLVER_TABLE_BITS);
+}
+
+bool Solver::isDead(unsigned int key)
+{
+    return _dead[slot(key)] == key;
+}
+
+// a later dead position replaces whichever one shared its slot
+void Solver::setDead(unsigned int key)
+{
+    _dead[slot(key)] = key;
+}
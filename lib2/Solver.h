@@ -0,0 +1,67 @@
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include "Utils.h"
+
+// the dead (unsolvable) positions remembered by the solver, 2^SOLVER_TABLE_BITS entries
+#define SOLVER_TABLE_BITS 9
+
+// the longest tile list the solver can search (the tile index is kept in 5 bits)
+#define SOLVER_MAX_TILES 32
+
+// every placement fills at least one cell, so a search is at most 27 moves deep
+#define SOLVER_MAX_DEPTH 27
+
+// the time checked every 2^SOLVER_CHECK_BITS steps of a search
+#define SOLVER_CHECK_BITS 3
+
+enum SolveResult {SOLVE_DEAD, SOLVE_SOLVABLE, SOLVE_UNKNOWN, SOLVE_SEARCHING};
+
+// a position on the search path, with the move being tried from it
+struct SolverFrame{
+    unsigned int space;
+    unsigned char index;
+    signed char orientation;
+    unsigned char placement; // the next move in list
+    PlacementList list; // the moves of the orientation
+};
+
+// Finds whether the rest of a tile list can still fill the game space, with
+// the moves the game allows (see findPlacements). It is a depth first search
+// over the placements of each tile in turn, which remembers the positions
+// (game space and tile index) it has proved to be dead in a small hash table,
+// so they are not searched again later in the level. A position is also dead
+// as soon as an empty cell can't be covered by any tile that is left.
+// The search path is kept in _stack rather than on the call stack, so that a
+// search can be stopped after a time slice and carried on from where it was
+class Solver
+{
+public:
+    Solver();
+    void reset();
+    void start(unsigned int space, const Level &level, int index, int budget);
+    SolveResult run(int slice_us);
+    SolveResult solve(unsigned int space, const Level &level, int index, int budget);
+    int getHint();
+    int getNodes();
+
+private:
+    void step();
+    void enter(unsigned int space, int index);
+    bool coverable(unsigned int space, int index);
+    bool isDead(unsigned int key);
+    void setDead(unsigned int key);
+    
+    int _tile_count;
+    const TileOrientations *_orientations[SOLVER_MAX_TILES]; // of each tile in the list
+    unsigned short _kinds_left[SOLVER_MAX_TILES]; // bit n set if kind n is at or after the index
+    int _budget;
+    int _nodes;
+    int _hint;
+    SolveResult _result;
+    int _depth;
+    SolverFrame _stack[SOLVER_MAX_DEPTH];
+    unsigned int _dead[1 << SOLVER_TABLE_BITS];
+};
+
+#endif
@@ -35,7 +35,7 @@ Vector3 rotateVector(const Vector3& v, const Quaternion& q)
     u.x = q.x;
     u.y = q.y;
     u.z = q.z;
-    float s = q.w;
+    Real s = q.w;
 
     Vector3 out = 2.0f * dot(u, v) * u
                   + (s*s - dot(u, u)) * v
@@ -44,9 +44,70 @@ Vector3 rotateVector(const Vector3& v, const Quaternion& q)
 }
 
 
+// Builds the matrix that applies rotateVector(v + relative_location, q) * scale + location
+// to a point v. The rotation block is the expansion of rotateVector, so it
+// scales by the squared length of q in the same way for a non-unit quaternion
+Matrix3x4 toAffineMatrix(const Quaternion& q, Vector3 relative_location, Vector3 scale, Vector3 location)
+{
+    Real const ww = q.w * q.w;
+    Real const xx = q.x * q.x;
+    Real const yy = q.y * q.y;
+    Real const zz = q.z * q.z;
+    Real const xy = 2 * q.x * q.y;
+    Real const xz = 2 * q.x * q.z;
+    Real const yz = 2 * q.y * q.z;
+    Real const wx = 2 * q.w * q.x;
+    Real const wy = 2 * q.w * q.y;
+    Real const wz = 2 * q.w * q.z;
+
+    Real const rotation[3][3] = {
+        {ww + xx - yy - zz, xy - wz,           xz + wy},
+        {xy + wz,           ww - xx + yy - zz, yz - wx},
+        {xz - wy,           yz + wx,           ww - xx - yy + zz}
+    };
+    Real const row_scale[3] = {scale.x, scale.y, scale.z};
+    Real const row_offset[3] = {location.x, location.y, location.z};
+
+    Matrix3x4 out;
+    for (int i = 0; i < 3; i++) {
+        // the relative location is rotated with the vertex, so it folds into the translation
+        Real const rotated_offset = rotation[i][0] * relative_location.x
+                                  + rotation[i][1] * relative_location.y
+                                  + rotation[i][2] * relative_location.z;
+        for (int j = 0; j < 3; j++) {
+            out.m[i][j] = rotation[i][j] * row_scale[i];
+        }
+        out.m[i][3] = rotated_offset * row_scale[i] + row_offset[i];
+    }
+    return out;
+}
+
+
+// Applies an affine transform to a point (9 multiply-adds)
+Vector3 transformPoint(const Matrix3x4& matrix, const Vector3& v)
+{
+    Vector3 out;
+    out.x = matrix.m[0][0] * v.x + matrix.m[0][1] * v.y + matrix.m[0][2] * v.z + matrix.m[0][3];
+    out.y = matrix.m[1][0] * v.x + matrix.m[1][1] * v.y + matrix.m[1][2] * v.z + matrix.m[1][3];
+    out.z = matrix.m[2][0] * v.x + matrix.m[2][1] * v.y + matrix.m[2][2] * v.z + matrix.m[2][3];
+    return out;
+}
+
+
+// Converts a mesh vertex from its flash representation to the engine's type
+Vector3 toVector3(const Vertex& v)
+{
+    Vector3 out;
+    out.x = v.x;
+    out.y = v.y;
+    out.z = v.z;
+    return out;
+}
+
+
 // Performs the dot product between two vectors
-float dot(Vector3 vector_a, Vector3 vector_b) {
-   float product = 0;
+Real dot(Vector3 vector_a, Vector3 vector_b) {
+   Real product = 0;
    product += vector_a.x * vector_b.x;
    product += vector_a.y * vector_b.y;
    product += vector_a.z * vector_b.z;
@@ -66,9 +127,9 @@ Vector3 cross( Vector3 a,  Vector3 b)
 
 
 // gets the magnitude of a 3D vector
-float magnitude(Vector3 vect)
+Real magnitude(Vector3 vect)
 {
-    return sqrt(vect.x * vect.x + vect.y * vect.y + vect.z * vect.z);
+    return length3(vect.x, vect.y, vect.z);
 }
 
 
@@ -82,7 +143,7 @@ Vector3 calculateNormal(Vector3 p1, Vector3 p2, Vector3 p3)
     Vector3 normal = cross(vect,vect2);
 
     // normalise
-    double length = magnitude(normal);
+    Real length = magnitude(normal);
     normal.x = normal.x/length;
     normal.y = normal.y/length;
     normal.z = normal.z/length;
@@ -91,137 +152,25 @@ Vector3 calculateNormal(Vector3 p1, Vector3 p2, Vector3 p3)
 }
 
 
-// Level definitions
-vector<Tile> levelSelect(int sel){
-    vector<Tile> lvl_tile_list;
-    Tile O_tile =  {0x4000000, {1,1,1}};
-    Tile i_tile =  {0x6000000, {2,1,1}};
-    Tile l_tile =  {0x6800000, {2,2,1}};
-    Tile I_tile =  {0x7000000, {3,1,1}};
-    Tile L_tile =  {0x7200000, {3,2,1}};
-    Tile T_tile =  {0x7400000, {3,2,1}};
-    Tile C_tile =  {0x7A00000, {3,2,1}};
-    Tile Z_tile =  {0x6600000, {3,2,1}};
-    Tile X_tile =  {0x6820000, {2,2,2}};
-    lvl_tile_list.clear();
-    switch(sel){
-        case 0:
-            lvl_tile_list.push_back(T_tile);
-            lvl_tile_list.push_back(L_tile);
-            lvl_tile_list.push_back(O_tile);
-            lvl_tile_list.push_back(I_tile);
-            lvl_tile_list.push_back(i_tile);
-            lvl_tile_list.push_back(i_tile);
-            lvl_tile_list.push_back(i_tile);
-            lvl_tile_list.push_back(O_tile);
-            lvl_tile_list.push_back(I_tile);
-            lvl_tile_list.push_back(I_tile);
-            lvl_tile_list.push_back(i_tile);
-            break;
-        case 1:
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(l_tile);
-            break;
-        case 2:
-            lvl_tile_list.push_back(I_tile);
-            lvl_tile_list.push_back(T_tile);
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(I_tile);
-            lvl_tile_list.push_back(L_tile);
-            lvl_tile_list.push_back(T_tile);
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(l_tile);
-            break;
-        case 3:
-            lvl_tile_list.push_back(T_tile);
-            lvl_tile_list.push_back(T_tile);
-            lvl_tile_list.push_back(C_tile);
-            lvl_tile_list.push_back(C_tile);
-            lvl_tile_list.push_back(L_tile);
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(i_tile);
-            break;
-        case 4:
-            lvl_tile_list.push_back(Z_tile);
-            lvl_tile_list.push_back(Z_tile);
-            lvl_tile_list.push_back(Z_tile);
-            lvl_tile_list.push_back(Z_tile);
-            lvl_tile_list.push_back(I_tile);
-            lvl_tile_list.push_back(C_tile);
-            lvl_tile_list.push_back(I_tile);
-            break;
-        case 5:
-            lvl_tile_list.push_back(C_tile);
-            lvl_tile_list.push_back(C_tile);
-            lvl_tile_list.push_back(C_tile);
-            lvl_tile_list.push_back(C_tile);
-            lvl_tile_list.push_back(C_tile);
-            lvl_tile_list.push_back(O_tile);
-            lvl_tile_list.push_back(O_tile);
-            break;
-        case 6:
-            lvl_tile_list.push_back(X_tile);
-            lvl_tile_list.push_back(X_tile);
-            lvl_tile_list.push_back(X_tile);
-            lvl_tile_list.push_back(X_tile);
-            lvl_tile_list.push_back(X_tile);
-            lvl_tile_list.push_back(l_tile);
-            lvl_tile_list.push_back(I_tile);
-            lvl_tile_list.push_back(O_tile);
-            break;
-        case 7:
-            lvl_tile_list.push_back(Z_tile);
-            lvl_tile_list.push_back(T_tile);
-            lvl_tile_list.push_back(L_tile);
-            lvl_tile_list.push_back(C_tile);
-            lvl_tile_list.push_back(X_tile);
-            lvl_tile_list.push_back(X_tile);
-            lvl_tile_list.push_back(i_tile);
-            break;
-        case 8:
-            break;
-        case 9:
-            break;
-        case 10:
-            break;
-        case 11:
-            break;
-        case 12:
-            break;
-        case 13:
-            break;
-        case 14:
-            break;
-        case 15:
-            break;
-        case 16:
-            break;
-        case 17:
-            break;
-        case 18:
-            break;
-        case 19:
-            break;
-        case 20:
-            break;
-        case 21:
-            break;
-        case 22:
-            break;
-        case 23:
-            break;
-        case 24: 
-            break;
-            
-    }
+// returns the positions an orientation of a tile can be placed at in a game
+// space, at most one for each y, z offset. The piece is moved along x from the
+// largest offset until it doesn't collide with the game space, the masks of the
+// positions are precomputed in the orientation tables
+PlacementList findPlacements(const Orientation &orientation, unsigned int space)
+{
+    PlacementList pos_list;
+    pos_list.count = 0;
     
-    return lvl_tile_list;
-}
\ No newline at end of file
+    int const depth = 4 - orientation.tile.size[0]; // x offsets in each column
+    int const columns = (4-orientation.tile.size[1])*(4-orientation.tile.size[2]);
+    const int *column = orientation.placements;
+    for(int i = 0; i < columns; i++, column += depth){
+        for(int x = 0; x < depth; x++){
+            if((column[x] & space) == 0){ // detect collisions
+                pos_list.masks[pos_list.count++] = column[x];
+                break;
+            }
+        }
+    }
+    return pos_list;
+}
@@ -4,18 +4,92 @@
 
 #define WIN 2
 #define LOSE 1
+
+// uncomment to run the 3D engine in Q16.16 fixed-point instead of
+// (software) floating point arithmetic
+//#define FIXED_POINT
+
 #include <vector>
+#include <math.h>
+#include "Fixed.h"
+#include "platform/Span.h"
 using namespace std;
 
+// numeric type used by the 3D engine
+#ifdef FIXED_POINT
+typedef Fixed Real;
+#else
+typedef float Real;
+
+inline int toInt(float value)
+{
+    return (int)value;
+}
+
+inline float toFloat(float value)
+{
+    return value;
+}
+
+inline float length3(float x, float y, float z)
+{
+    return sqrt(x * x + y * y + z * z);
+}
+#endif
+
 struct Tile{
     int shape;
     char size[3];
 };
 
-struct Vector3{
+// the tile shapes used by the levels
+enum TileKind {TILE_O, TILE_i, TILE_l, TILE_I, TILE_L, TILE_T, TILE_C, TILE_Z, TILE_X, TILE_KINDS};
+
+// one orientation of a tile kind, moved to the 0,0,0 corner of the game space,
+// with the game space mask of every translation of it: (4-size[1])*(4-size[2])
+// columns (y, z offsets) of 4-size[0] masks (x offsets, from the largest down)
+struct Orientation{
+    Tile tile;
+    const int *placements;
+};
+
+// a tile kind and the distinct orientations it can be placed in
+struct TileOrientations{
+    Tile tile;
+    unsigned char count;
+    const Orientation *orientations;
+};
+
+// generated by host/OrientationGen.cpp, in Orientations.cpp
+extern const TileOrientations tile_orientations[TILE_KINDS];
+
+// a level, the kinds of its tiles in the order they are placed
+typedef mbed::Span<const TileKind> Level;
+
+#define LEVEL_COUNT 24
+
+// in Levels.cpp, levels that haven't been designed have no tiles
+extern const Level levels[LEVEL_COUNT];
+
+// the positions an orientation of a tile can be placed at, as game space masks
+// (at most one for each of the 3x3 y, z offsets)
+struct PlacementList{
+    unsigned char count;
+    int masks[9];
+};
+
+// mesh vertex as stored in flash, kept as float so that the Data.h tables
+// are initialised at compile time whichever Real type is selected
+struct Vertex{
     float x;
     float y;
     float z;
+};
+
+struct Vector3{
+    Real x;
+    Real y;
+    Real z;
     
     friend Vector3 operator+(const Vector3& a, const Vector3& b) {
         Vector3 out;
@@ -25,7 +99,7 @@ struct Vector3{
         return out;
     }
     
-    friend Vector3 operator+(const Vector3& a, float b) {
+    friend Vector3 operator+(const Vector3& a, Real b) {
         Vector3 out;
         out.x = a.x + b;
         out.y = a.y + b;
@@ -49,7 +123,7 @@ struct Vector3{
         return out;
     }
     
-    friend Vector3 operator*(float b, const Vector3& a) {
+    friend Vector3 operator*(Real b, const Vector3& a) {
         Vector3 out;
         out.x = a.x * b;
         out.y = a.y * b;
@@ -65,7 +139,7 @@ struct Vector3{
         return out;
     }
     
-    friend Vector3 operator/(const Vector3& a, const float b) {
+    friend Vector3 operator/(const Vector3& a, const Real b) {
         Vector3 out;
         out.x = a.x / b;
         out.y = a.y / b;
@@ -85,10 +159,10 @@ struct Obj{
 
 struct Quaternion {
     // used to define quaternions
-    float x;
-    float y;  
-    float z;  
-    float w; 
+    Real x;
+    Real y;  
+    Real z;  
+    Real w; 
     
     // Defines the multiplication operation of Quaternions
     // Source: https://stackoverflow.com/questions/19956555/how-to-multiply-two-quaternions
@@ -105,21 +179,33 @@ struct Quaternion {
 };
 
 
+// 3x4 affine transform, the left 3x3 block is applied to a point and the
+// last column is added to the result
+struct Matrix3x4{
+    Real m[3][4];
+};
+
+
 struct ObjData{
-    const Vector3 *verts_ptr;
+    const Vertex *verts_ptr;
+    const unsigned short verts_len;
     const unsigned short *faces_ptr;
     const unsigned short faces_len;
+    const float radius; // distance of the furthest vertex from the origin, rounded up
 };
 
 
 Quaternion ToQuaternion(double yaw, double pitch, double roll);
 Vector3 rotateVector(const Vector3& v, const Quaternion& q);
+Vector3 toVector3(const Vertex& v);
+Matrix3x4 toAffineMatrix(const Quaternion& q, Vector3 relative_location, Vector3 scale, Vector3 location);
+Vector3 transformPoint(const Matrix3x4& matrix, const Vector3& v);
 
-float dot(Vector3 vector_a, Vector3 vector_b);
+Real dot(Vector3 vector_a, Vector3 vector_b);
 Vector3 cross(Vector3 a, Vector3 b);
-float magnitude(Vector3 point);
+Real magnitude(Vector3 point);
 Vector3 calculateNormal(Vector3 p1, Vector3 p2, Vector3 p3);
 
-vector<Tile> levelSelect(int sel);
+PlacementList findPlacements(const Orientation &orientation, unsigned int space);
 
 #endif
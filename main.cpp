@@ -15,6 +15,10 @@
 #include "Menu.h"
 #include "Data.h"
 
+// send every frame over the USB serial port, to watch the screen on a PC
+// with host/FrameViewer.cpp (see N5110::mirrorTo)
+//#define MIRROR_LCD
+
 // initialise pin allocations
 Joystick joystick(p20, p19);
 InterruptIn buttonA(p29);
@@ -24,6 +28,9 @@ InterruptIn buttonD(p26);
 InterruptIn buttonJ(p17);
 Ticker debounceDelay;
 Ticker jsRead;
+#ifdef MIRROR_LCD
+UARTSerial lcd_mirror(USBTX, USBRX, 115200);  // writes are queued and sent from interrupts
+#endif
 
 Object Cube2;
 Object Trophy;
@@ -55,6 +62,7 @@ struct State {
 };
 
 Game GlobalGame; // global game object
+const Level *g_game_level = NULL; // level GlobalGame is set up for, NULL once it has been played
 
 // set the button A flag
 void buttonA_isr()
@@ -95,6 +103,16 @@ void resetRotation(){
 }
 
 
+// sets the game object up for a level, only when it isn't already (the menus
+// that lead to a game call this every frame)
+void selectLevel(const Level &level){
+    if(g_game_level != &level){
+        GlobalGame.init(level);
+        g_game_level = &level;
+    }
+}
+
+
 void delay_isr(){
      // detach the timer and read the joystick button
      debounceDelay.detach();
@@ -181,6 +199,8 @@ void drawLvlBox(unsigned char lvl, int i, int j)
 // Draws the title screen
 void drawStartScreen(int angle){
     lcd.clear();
+    Real const radius = Cube2.getRadius() * 13;
+    setDepthRange(-radius, radius);
     clearDepth(); 
     Quaternion rotation = ToQuaternion((angle/570.0)*PI, (angle/890.0)*PI, (angle/530.0)*PI);
     Vector3 relative_loc = {0,0,0};
@@ -194,13 +214,15 @@ void drawStartScreen(int angle){
 // Displays a trophy at a specified angle to create an animation
 void winAnimation(int angle){
     lcd.clear();
+    Real const radius = Trophy.getRadius() * 12;
+    setDepthRange(-radius, radius);
     clearDepth(); 
     Quaternion rotation = ToQuaternion(PI, (angle/36.0)*PI, 0);
     Vector3 relative_loc = {0,0,0};
     Vector3 location  = {42,26,0};
     Vector3 scale = {12,12,12};
     Trophy.setLocRotScale(location, relative_loc, rotation, scale);
-    Trophy.draw(FILL_WHITE);
+    Trophy.draw(FILL_WHITE, true);
     lcd.drawRect(18,35,84-37, 11, FILL_TRANSPARENT);
     lcd.drawRect(18+1,35+1,84-37-2, 11-2, FILL_WHITE);
     lcd.printString("YOU WIN",centerAlign("YOU WIN"),37);
@@ -211,13 +233,15 @@ void winAnimation(int angle){
 // Draws the specified object to the screen
 void drawObject(float scale_factor, Object Obj){
     lcd.clear();
+    Real const radius = Obj.getRadius() * 15 * scale_factor;
+    setDepthRange(-radius, radius);
     clearDepth(); 
     Quaternion rotation = ToQuaternion(PI, (160.0/36.0)*PI, 0);
     Vector3 relative_loc = {0,0,0};
     Vector3 location  = {42,24,0};
     Vector3 scale = {15,15,15};
     Obj.setLocRotScale(location, relative_loc, g_rotation, scale_factor*scale);
-    Obj.draw(FILL_WHITE);
+    Obj.draw(FILL_WHITE, true);
     lcd.refresh();
 }
 
@@ -241,6 +265,9 @@ int main()
     
     // lcd, joystick & interrupt initialisation
     lcd.init();
+#ifdef MIRROR_LCD
+    lcd.mirrorTo(&lcd_mirror);
+#endif
     lcd.setContrast(0.4);
     lcd.backLightOn();
     joystick.init();
@@ -364,7 +391,7 @@ int main()
                     // initialise game object with selected level data
                 }
                 resetRotation();
-                GlobalGame.init(levelSelect(lvl_select));
+                selectLevel(levels[lvl_select]);
                 break;
             }
                 
@@ -382,6 +409,7 @@ int main()
                 
                 // draw frame and get the game state (continue 0, lose 1, win 2)
                 game_state = GlobalGame.getFrame();
+                g_game_level = NULL; // the game has changed, it must be set up again before the next one
                 
                 // determine which state to go to according the game state
                 if (game_state == WIN){
@@ -407,7 +435,7 @@ int main()
                 angle++;
                 winAnimation(angle); // draw game win animation frame
                 resetRotation();
-                GlobalGame.init(levelSelect(lvl_select)); // reset game object
+                selectLevel(levels[lvl_select]); // reset game object
                 lvl_arr[lvl_select] = 0b00000011; // set level as a win
                 
                 if(lvl_select < 23){
@@ -421,7 +449,7 @@ int main()
             {
                 loseMenu.draw(selected); // draw lsoe menu
                 resetRotation();
-                GlobalGame.init(levelSelect(lvl_select)); // reset game object
+                selectLevel(levels[lvl_select]); // reset game object
                 
                 // if the level has not already been won
                 if((lvl_arr[lvl_select] & 0b00000011) != 0b00000011)
@@ -471,7 +499,7 @@ int main()
                     }    
                     drawObject(scale, Obj);
                     std::string names[] = {"Monkey", "Torus", "Sphere", ""};
-                    lcd.drawRect(0, 0, names[sel_object].length()*6, 8, FILL_WHITE);
+                    lcd.drawRect(0, 0, lcd.stringWidth(names[sel_object].c_str()), 8, FILL_WHITE);
                     lcd.printString(names[sel_object].c_str(), 0, 0);
                     
                     lcd.drawRect(60, 0, 24, 8, FILL_WHITE);
@@ -485,13 +513,13 @@ int main()
                 
             case 8: 
             {
-                lcd.drawSprite(controlButtons);
+                lcd.drawSprite(control_buttons, 0, 0);
                 break;
             }
                 
             case 9:
             {
-                lcd.drawSprite(controlJoystick);
+                lcd.drawSprite(control_joystick, 0, 0);
                 break;
             }
                 